@@ -0,0 +1,148 @@
+/**
+ *  @file  ChannelView.hpp
+ *
+ *  @brief  A class template for views of the channels of images with multi-sample
+ *          pixels, and functions to convert between interleaved and planar images.
+ *
+ *  A class template for views of the channels of images with multi-sample pixels, and
+ *  functions to convert between interleaved and planar images.
+ */
+
+  #ifndef   ISL_IMAGE_CHANNEL_VIEW_HPP_INCLUDED
+    #define ISL_IMAGE_CHANNEL_VIEW_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+
+    #include <ranges>
+    #include <type_traits>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for views of the channels of images with multi-sample pixels.
+ *
+ *  A channel view refers to count consecutive samples, starting with the sample at index,
+ *  of each pixel of an image, in place, e.g., the alpha channel of an ARGB image.  It
+ *  holds a copy of the image, sharing its buffer, and addresses the samples with a sample
+ *  stride of the number of samples per pixel, so creating a view copies no pixels.
+ *
+ *  The index, the count, and the order of the samples in the view are exactly those of
+ *  the DirectImage (src, index, count) constructor: the view refers to the samples which
+ *  that constructor would copy, in the same order, on any platform.  The view maps each
+ *  sample index to the position of the sample in memory, which for packed samples
+ *  depends upon the byte order, so, e.g., the alpha channel of an ARGB image has the
+ *  same index on little-endian and big-endian platforms.  The sample type must be the
+ *  size of one sample, and index+count must not exceed the number of samples per pixel,
+ *  or std::invalid_argument is thrown.  When contiguous planes are really needed, use
+ *  Deinterleave.
+ *
+ *  A view of a mutable sample type, which writes through to the image, can only be
+ *  created from a mutable image; a view of a constant image has a const sample type.
+ */
+
+        template <typename ImageT,
+                  typename SampleT>
+          class ChannelView
+            {
+//
+//  Constructor ...
+//
+              public:
+                ChannelView(ImageT& image_,
+                            int     index_,
+                            int     count_);
+                ChannelView(const ImageT& image_,
+                            int           index_,
+                            int           count_)
+                    requires std::is_const_v<SampleT>;
+//
+//  Accessors ...
+//
+              public:
+                const ISL::Image::Bounds& Bounds() const;
+                int ChannelCount() const;
+                std::ptrdiff_t SampleStride() const;
+                std::ptrdiff_t    RowStride() const;
+
+                SampleT* SamplePtr(ISL::Image::Coordinate x,
+                                   ISL::Image::Coordinate y) const;
+                SampleT& Sample(ISL::Image::Coordinate x,
+                                ISL::Image::Coordinate y,
+                                int                    channel) const;
+//
+//  Data ...
+//
+              private:
+                ///  a copy of the image, sharing its buffer
+                const ImageT image;
+                ///  the first sample of the view, in the first pixel of the image
+                SampleT* firstSample = nullptr;
+                ///  the number of channels in the view
+                const int count;
+                ///  the distance, in samples, between the samples of adjacent pixels
+                std::ptrdiff_t sampleStride = 0;
+                ///  the distance, in samples, between the samples of adjacent rows
+                std::ptrdiff_t rowStride = 0;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The channel functions ...
+//
+//  Channels creates a channel view of an image; unlike the DirectImage (src, index, count)
+//  constructor, which copies the samples into a new image, it copies nothing.  A view of
+//  a const image has a const sample type.  Deinterleave copies each channel of an image
+//  into a separate single-sample plane, and Interleave does the reverse.  The planes are
+//  any contiguous range of images, e.g., a std::vector, std::array, or std::span of them;
+//  there must be one plane for each sample of a pixel.
+//
+//  Deinterleave gives each plane the bounds of the image, as TransformInto gives its
+//  destination.  Interleave requires each plane to have the bounds of the image, or
+//  std::invalid_argument is thrown.  It writes the image in place if the image is
+//  writable, i.e., unique and not read-only; otherwise it first gives the image a new
+//  buffer, with its margin and allocation policy, as TransformInto does, so other images
+//  which shared the old buffer are unchanged.
+//
+//  Two, three, and four channels of 8-bit and 16-bit samples, e.g., ARGB to four planes
+//  and back, use SIMD shuffle kernels selected by ISL::Image::Dispatch, a row at a time.
+//
+
+    namespace ISL::Image
+      {
+        template <typename SampleT,
+                  typename ImageT>
+            requires (!std::is_const_v<ImageT>)
+          ISL::Image::ChannelView<ImageT,SampleT> Channels(ImageT& image,
+                                                           int     index,
+                                                           int     count);
+        template <typename SampleT,
+                  typename ImageT>
+          ISL::Image::ChannelView<ImageT,const SampleT> Channels(const ImageT& image,
+                                                                 int           index,
+                                                                 int           count);
+
+        template <typename                       ImageT,
+                  std::ranges::contiguous_range PlanesT>
+            requires (!std::is_const_v<std::remove_reference_t<
+                                         std::ranges::range_reference_t<PlanesT>>>)
+          void Deinterleave(const ImageT& image,
+                            PlanesT&&     planes);
+
+        template <std::ranges::contiguous_range PlanesT,
+                  typename                       ImageT>
+          void Interleave(const PlanesT& planes,
+                          ImageT&        image);
+      }
+
+  #endif
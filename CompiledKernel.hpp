@@ -0,0 +1,197 @@
+/**
+ *  @file  CompiledKernel.hpp
+ *
+ *  @brief  A class template for kernels of arbitrary geometry compiled into pointer offsets.
+ *
+ *  A class template for kernels of arbitrary geometry compiled into pointer offsets.
+ */
+
+  #ifndef   ISL_IMAGE_COMPILED_KERNEL_HPP_INCLUDED
+    #define ISL_IMAGE_COMPILED_KERNEL_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TiledConvolution.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <concepts>
+    #include <vector>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  @brief  a tap of a kernel
+        template <typename WeightT>
+          struct KernelTap
+            {
+              ///  the position of the tap relative to the kernel origin
+              ISL::Image::Coordinates offset;
+              ///  the weight of the tap
+              WeightT weight;
+            };
+
+        ///  a padded view of an image, e.g., a DirectImage PaddedImageView
+        template <typename ViewT>
+          concept PaddedSource = requires (const ViewT&                   view,
+                                           const ISL::Image::Bounds&      bounds,
+                                           const ISL::Image::Coordinates& point)
+            {
+              view.Source();
+              { view.Bounds() } -> std::convertible_to<ISL::Image::Bounds>;
+              { view.InteriorBounds(bounds) } -> std::convertible_to<ISL::Image::Bounds>;
+              view.Pixel(point);
+              view.PixelPtr(point);
+              { view.SubView(bounds) } -> std::convertible_to<ViewT>;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for kernels of arbitrary geometry compiled into pointer
+ *          offsets.
+ *
+ *  Compiling a kernel for the row stride of an image buffer turns the position of each
+ *  tap into the pointer offset y*stride+x, so the weighted sum at a kernel position is
+ *  computed over flat arrays, sum += w[i]*p[off[i]], with no coordinate arithmetic; the
+ *  loop vectorizes with gathers, and the offsets are known in advance for prefetching.
+ *  The taps are sorted into raster order and horizontally adjacent taps are grouped into
+ *  runs, each a contiguous span of both pixels and weights, so runs of more than a few
+ *  taps are computed as SIMD dot products.  Taps with zero weight are removed.
+ *
+ *  A compiled kernel applies only to images whose row stride is the stride for which it
+ *  was compiled; Convolve throws a std::invalid_argument for any other image.  The
+ *  source image must cover the destination bounds extended by the kernel bounds.
+ *
+ *  The source may instead be a padded view, whose source image has the compiled stride,
+ *  covering the destination bounds extended by the kernel bounds; nothing is then copied
+ *  to pad the image.  Destination pixels within the interior bounds of the view are
+ *  computed from the compiled offsets, with pointers into the source image, and only
+ *  those in the border strips around the interior are computed tap by tap from the
+ *  padded pixels of the view, at the tap positions retained for this purpose.  These
+ *  Convolve functions are tiled like the others, with the sub-views of the tiles.
+ *
+ *  The Convolve functions are tiled and parallel: they split the destination into the
+ *  tiles of the schedule, or of a default schedule, and convolve each tile with
+ *  ConvolveTile, in the thread to which the tile is assigned.  ConvolveTile stores its
+ *  results directly in the destination image's current buffer, even when that buffer is
+ *  shared, as it is by the sub-image of a tile, and never replaces the buffer.  Given a
+ *  padded view, ConvolveTile computes the interior and border strips of the tile, with
+ *  the interior bounds of the tile's sub-view.
+ */
+
+        template <typename WeightT>
+          class CompiledKernel
+            {
+//
+//  Types ...
+//
+              public:
+                ///  the weight type
+                using Weight = WeightT;
+
+                ///  @brief  a run of horizontally adjacent taps
+                struct Run
+                  {
+                    ///  the pointer offset of the first tap of the run
+                    std::ptrdiff_t offset = 0;
+                    ///  the number of taps in the run
+                    int length = 0;
+                    ///  the index of the weight of the first tap of the run
+                    int firstWeight = 0;
+                  };
+//
+//  Constructor ...
+//
+              public:
+                CompiledKernel(const std::vector<ISL::Image::KernelTap<WeightT>>& taps,
+                               std::ptrdiff_t                                     rowStride_);
+//
+//  Accessors ...
+//
+              public:
+                std::ptrdiff_t RowStride() const;
+                ISL::Image::Bounds Bounds() const;
+                const std::vector<std::ptrdiff_t>& Offsets() const;
+                const std::vector<WeightT>&        Weights() const;
+                const std::vector<Run>&               Runs() const;
+//
+//  Convolution ...
+//
+              public:
+                template <typename PixelT>
+                  WeightT Apply(const PixelT* originPtr) const;
+
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void Convolve(const SrcImageT& srcImage,
+                                DstImageT&       dstImage) const;
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void Convolve(const SrcImageT&                srcImage,
+                                DstImageT&                      dstImage,
+                                const ISL::Image::TileSchedule& schedule) const;
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void ConvolveTile(const SrcImageT& srcImage,
+                                    DstImageT&       dstImage) const;
+
+                template <ISL::Image::PaddedSource SrcViewT,
+                          typename                 DstImageT>
+                  void Convolve(const SrcViewT& srcView,
+                                DstImageT&      dstImage) const;
+                template <ISL::Image::PaddedSource SrcViewT,
+                          typename                 DstImageT>
+                  void Convolve(const SrcViewT&                 srcView,
+                                DstImageT&                      dstImage,
+                                const ISL::Image::TileSchedule& schedule) const;
+                template <ISL::Image::PaddedSource SrcViewT,
+                          typename                 DstImageT>
+                  void ConvolveTile(const SrcViewT& srcView,
+                                    DstImageT&      dstImage) const;
+//
+//  Data ...
+//
+              private:
+                ///  the row stride for which the kernel is compiled
+                const std::ptrdiff_t rowStride;
+                ///  the bounds of the taps relative to the kernel origin
+                ISL::Image::Bounds bounds;
+                ///  the pointer offsets of the taps, in raster order
+                std::vector<std::ptrdiff_t> offsets;
+                ///  the positions of the taps relative to the kernel origin, in raster order
+                std::vector<ISL::Image::Coordinates> positions;
+                ///  the weights of the taps, in raster order
+                std::vector<WeightT> weights;
+                ///  the runs of horizontally adjacent taps
+                std::vector<Run> runs;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The kernel compilation function ...
+//
+
+    namespace ISL::Image
+      {
+        template <typename WeightT,
+                  typename ImageT>
+          ISL::Image::CompiledKernel<WeightT>
+            Compile(const std::vector<ISL::Image::KernelTap<WeightT>>& taps,
+                    const ImageT&                                      image);
+      }
+
+  #endif
@@ -11,13 +11,21 @@
     #define ISL_IMAGE_DIRECT_IMAGE_HPP_INCLUDED
 
     #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/InstructionSet.hpp>
+    #include <ISL/Image/PixelConversion.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
     #include <ISL/Support/Option.hpp>
     #include <ISL/Support/PinnedCast.hpp>
 
     #include <algorithm>
     #include <atomic>
+    #include <compare>
+    #include <concepts>
+    #include <execution>
     #include <iterator>
     #include <memory>
+    #include <memory_resource>
+    #include <span>
     #include <stdexcept>
     #include <string>
     #include <type_traits>
@@ -55,6 +63,62 @@
         ///  create an end iterator?
         using EndIterator = ISL::Support::Option<Option_EndIterator>;
 
+        template <typename ExpressionT>
+          class ImageExpression;  // forward declaration
+
+/**
+ *  @brief  The layout of a newly allocated image buffer.
+ *
+ *  An allocation policy aligns the first pixel of every row of an image buffer, so SIMD
+ *  kernels can use aligned loads and stores.  The row stride, the distance in pixels
+ *  between the first pixels of adjacent rows, is the smallest value not less than the
+ *  buffer width for which every row is aligned.  If avoidAliasing is set and the stride
+ *  in bytes is a multiple of 1024, i.e., has a power-of-two factor large enough that the
+ *  rows of a column fall into a few cache sets, the stride is increased by one pad unit,
+ *  so vertically adjacent pixels map to different cache sets.  The pad unit is the row
+ *  alignment, or one pixel if the row alignment is zero; a row alignment of 1024 bytes
+ *  or more can not be combined with avoidAliasing, and std::invalid_argument is thrown.
+ *  The stride is recorded separately from the buffer bounds, and any difference between
+ *  the stride and the image width is part of the padding.  A row alignment of zero,
+ *  without avoidAliasing, packs the rows, which is the layout used by the constructors
+ *  without an allocation policy.
+ *
+ *  For an image allocated with a margin, it is the first pixel of each row of the image,
+ *  not the first pixel of the margin, which is aligned: the stride is computed for the
+ *  buffer width, including the margin, and the buffer is offset within its allocation so
+ *  that the margin pixels precede an aligned address.
+ *
+ *  The buffer, and the shared buffer information, are allocated from the memory resource
+ *  of the policy, e.g., an arena, a per-frame std::pmr::monotonic_buffer_resource, or a
+ *  pooled resource, and are returned to it when the last image sharing the buffer is
+ *  destroyed; the memory resource must therefore outlive those images.  A null memory
+ *  resource uses std::pmr::new_delete_resource().  Clones, including those made by
+ *  MakeUnique, keep the layout of the original but are allocated from
+ *  std::pmr::new_delete_resource(), so they remain valid after, e.g., a per-frame arena
+ *  is reset; to clone into a particular resource, pass clone an allocation policy.
+ *
+ *  When the pixels are initialized, they are initialized with the initialization
+ *  schedule, by default serially.  Since the first write to a page usually determines
+ *  its NUMA node, initializing with a schedule with static tile assignment, and
+ *  processing with schedules with static assignment and the same thread count, places
+ *  the pages of each band of rows on the node of the core which will process it, even
+ *  if the later stages use other pixel types or tile sizes; with dynamic assignment no
+ *  such placement results.
+ */
+
+        struct AllocationPolicy
+          {
+            ///  the alignment of the first pixel of each row, in bytes: zero or a power of two
+            int rowAlignment = 64;
+            ///  pad the row stride to avoid cache set aliasing between adjacent rows?
+            bool avoidAliasing = false;
+            ///  the memory resource from which the buffer is allocated
+            std::pmr::memory_resource* memoryResource = nullptr;
+            ///  the schedule with which the pixels are initialized, if they are
+            ISL::Image::TileSchedule initSchedule
+                                       = ISL::Image::TileSchedule { .threadCount = 1 };
+          };
+
 /**
  *  @brief  A class template for images with the pixel <em>values</em> stored in the
  *          image buffer.
@@ -64,12 +128,41 @@
  *  PixelInfo.  This class does not support packed pixels, but does support packed samples.
  *  One constructor can create an image which uses an externally managed image buffer;
  *  the copy constructors can create copies which share the image buffer of the source,
- *  even if the copy is of only part of the source image.
+ *  even if the copy is of only part of the source image.  The converting constructors
+ *  convert the pixels a row at a time, or all at once if they are contiguous, with the
+ *  vectorized ConvertPixels and ScalePixels functions; they therefore round and saturate
+ *  as those functions do, rather than converting with a static_cast.
+ *
+ *  A buffer may be read-only, e.g., a read-only memory mapping.  IsWritable is false for
+ *  an image with a read-only buffer, as well as for one sharing its buffer.
+ *  TransformInPlace, TransformInto, and assignment of an expression write into the
+ *  existing buffer of the destination only if it is writable, and otherwise give it a
+ *  new buffer; PadHalo throws std::logic_error for an image with a read-only buffer.  The
+ *  pixel accessors never copy, since the non-const accessors are chosen for every
+ *  non-const image, even one which is only read; pixels of a read-only buffer must not be
+ *  written through them.  Call MakeUnique first to write to a private copy.
  *
  *  The class provides iterator and const_iterator classes for accessing from the first
  *  to the last pixels of an image.  To iterate over a rectangular region of interest,
  *  use a copy constructor to create an image of just that region, sharing the image
- *  buffer if appropriate, and iterate over the pixels of the copy.
+ *  buffer if appropriate, and iterate over the pixels of the copy.  The Rows functions
+ *  provide ranges of the rows of an image, each a std::span of contiguous pixels, for
+ *  kernels which process an image a row at a time.
+ *
+ *  An image can be allocated with a margin, a border of pixels reserved in the buffer
+ *  around the image bounds.  WithHalo creates an image of the image and (part of) its
+ *  margin, sharing the buffer, and the PadHalo functions of the padders write just the
+ *  margin strips around an image, so a pipeline can allocate its images once and re-pad
+ *  them after each stage without touching the image pixels or reallocating.  The margin
+ *  is recorded in the shared buffer information, with the part of the buffer around
+ *  which it was reserved.  Margin returns the width of the reserved margin, the same on
+ *  each of the four sides, for an image covering exactly that part of the buffer, and
+ *  zero for any other image sharing the buffer, e.g., a region of interest, whose
+ *  surrounding pixels are pixels of the parent image.  WithHalo and PadHalo throw
+ *  std::invalid_argument for a margin greater than Margin(), so PadHalo never writes
+ *  outside of the reserved margin.  The top and bottom strips are written as whole rows,
+ *  and the side strips with SIMD copies, or reversals when mirroring, of the edge
+ *  columns, so re-padding costs O(W+H) per unit of margin rather than O(W*H).
  */
 
         template <typename              PixelT,
@@ -88,6 +181,10 @@
                 template <typename IterPixelT,
                           typename IterImageT>
                   class iterator_base;  // forward declaration
+                ///  the base row range type
+                template <typename RowPixelT,
+                          typename RowImageT>
+                  class row_range_base;  // forward declaration
 
                 ///  @brief  the shared buffer information
                 ///  @note   The callback is NOT propagated to clones.
@@ -101,6 +198,18 @@
                     void (*release)(const void*, void*) = nullptr;
                     ///  passed as the second argument to the release callback
                     void* releaseContext = nullptr;
+                    ///  the policy with which the buffer was allocated; clones use its layout
+                    const ISL::Image::AllocationPolicy allocationPolicy
+                              = ISL::Image::AllocationPolicy { .rowAlignment = 0 };
+                    ///  the size of the buffer allocation, in bytes
+                    std::ptrdiff_t bufferBytes = 0;
+                    ///  must the buffer not be written, e.g., a read-only memory mapping?
+                    bool readOnly = false;
+                    ///  the part of the buffer, relative to its minimum, around which the
+                    ///  margin was reserved
+                    ISL::Image::Bounds marginBounds;
+                    ///  the width of the margin reserved on each side of marginBounds
+                    ISL::Image::Size margin = 0;
                   };
 
               public:
@@ -110,11 +219,19 @@
                 ///  iterator to constant pixels
                 using const_iterator = iterator_base<const PixelT,
                                                      const DirectImage>;
+                ///  range of rows of mutable pixels
+                using row_range = row_range_base<PixelT,
+                                                 DirectImage>;
+                ///  range of rows of constant pixels
+                using const_row_range = row_range_base<const PixelT,
+                                                       const DirectImage>;
 
               public:
                 class   FillPadder;
                 class MirrorPadder;
                 class   TilePadder;
+                template <typename PadderT>
+                  class PaddedImageView;
 //
 //  Constructors and destructor ...
 //
@@ -128,6 +245,22 @@
                 DirectImage(const ISL::Image::Bounds&     bounds,
                             ISL::Image::InitPixels        initPixels);
 
+                DirectImage(ISL::Image::Size                    width,
+                            ISL::Image::Size                    height,
+                            ISL::Image::InitPixels              initPixels,
+                            const ISL::Image::AllocationPolicy& allocationPolicy);
+                DirectImage(const ISL::Image::Bounds&           bounds,
+                            ISL::Image::InitPixels              initPixels,
+                            const ISL::Image::AllocationPolicy& allocationPolicy);
+
+                DirectImage(const ISL::Image::Bounds&           bounds,
+                            ISL::Image::Size                    margin,
+                            ISL::Image::InitPixels              initPixels);
+                DirectImage(const ISL::Image::Bounds&           bounds,
+                            ISL::Image::Size                    margin,
+                            ISL::Image::InitPixels              initPixels,
+                            const ISL::Image::AllocationPolicy& allocationPolicy);
+
                 DirectImage(ISL::Image::Size              width,
                             ISL::Image::Size              height,
                             PixelT*                       pixels,
@@ -160,17 +293,26 @@
                   DirectImage(const ISL::Image::DirectImage<PixelT2,pixInfo2>& src,
                               const ScaleT&                                    scaleFactor);
 
+                template <typename ExpressionT>
+                  explicit DirectImage
+                    (const ISL::Image::ImageExpression<ExpressionT>& expression);
+
                 template <typename MatrixT>
+                    requires (!std::derived_from<MatrixT,ISL::Image::ImageExpression<MatrixT>>)
                   explicit DirectImage(const MatrixT& src);
                 template <typename MatrixT>
                   MatrixT ToMatrix() const;
 
                 DirectImage& operator = (const DirectImage&  rhs);
                 DirectImage& operator = (      DirectImage&& rhs) noexcept;
+                template <typename ExpressionT>
+                  DirectImage& operator = (const ISL::Image::ImageExpression<ExpressionT>& rhs);
 
                 DirectImage clone() const;
+                DirectImage clone(const ISL::Image::AllocationPolicy& allocationPolicy) const;
               private:
-                void   allocate(ISL::Image::InitPixels initPixels);
+                void   allocate(ISL::Image::InitPixels              initPixels,
+                                const ISL::Image::AllocationPolicy& allocationPolicy);
                 void deallocate();
 //
 //  Accessors ...
@@ -180,10 +322,15 @@
                 ISL::Image::Size  BufferWidth() const;
                 ISL::Image::Size BufferHeight() const;
                 ISL::Image::Size      Padding() const;
+                std::ptrdiff_t      RowStride() const;
+                ISL::Image::Size       Margin() const;
+                DirectImage WithHalo(ISL::Image::Size margin) const;
                 bool PixelsAreContiguous() const;
 
                 int RefCount() const;
                 bool IsUnique() const;
+                bool IsReadOnly() const;
+                bool IsWritable() const;
 
                 const PixelT* Buffer() const;
                       PixelT* Buffer();
@@ -207,6 +354,7 @@
                 void MakeUnique();
                 void SetReleaseCallback(void (*callback)(const void*,void*),
                                         void* callbackData = nullptr);
+                void SetReadOnly();
                 DirectImage& MovedTo(const ISL::Image::Coordinates& newMin);
 //
 //  Member data ...
@@ -214,6 +362,8 @@
               protected:
                 ///  the bounds of the image buffer
                 ISL::Image::Bounds bufferBounds;
+                ///  the distance, in pixels, between the first pixels of adjacent buffer rows
+                std::ptrdiff_t rowStride = 0;
                 ///  the image buffer
                 PixelT* buffer = nullptr;
                 ///  the shared buffer information
@@ -228,6 +378,16 @@
                 auto    end() const -> const_iterator;
                 auto cbegin() const -> const_iterator;
                 auto   cend() const -> const_iterator;
+//
+//  Row factory functions ...
+//
+              public:
+                auto Rows()       ->       row_range;
+                auto Rows() const -> const_row_range;
+                ///  @brief  the row at image coordinate y, from the minimum to the maximum y of
+                ///          the image bounds; std::out_of_range is thrown for any other y
+                auto Row(ISL::Image::Coordinate y)       -> std::span<      PixelT>;
+                auto Row(ISL::Image::Coordinate y) const -> std::span<const PixelT>;
             };
       }
 
@@ -241,7 +401,11 @@
 /**
  *  @brief  A base class template for DirectImage iterators.
  *
- *  A base class for the iterator and const_iterator classes.
+ *  A base class for the iterator and const_iterator classes.  The iterators are random
+ *  access iterators: the index of a pixel in iteration order is computed from the offset
+ *  of its pointer from the first pixel, the run length, and the padding, so moving an
+ *  iterator by n pixels, and the distance between two iterators, take constant time.
+ *  They can therefore be used with the parallel algorithms of the standard library.
  */
 
         template <typename              PixelT,
@@ -254,8 +418,10 @@
 //  Types ...
 //
               public:
-                ///  only forward iteration is supported
-                using iterator_category = std::forward_iterator_tag;
+                ///  random access iteration is supported
+                using iterator_category = std::random_access_iterator_tag;
+                ///  the iterator concept, for ranges and constrained algorithms
+                using iterator_concept = std::random_access_iterator_tag;
                 ///  dereferencing produces a pixel value
                 using value_type = IterPixelT;
                 ///  distance between points in an image
@@ -278,15 +444,35 @@
                 auto PixelPtr    () const -> pointer;
                 auto operator -> () const -> pointer;
                 auto operator *  () const -> reference;
+                auto operator [] (std::ptrdiff_t n) const -> reference;
                 auto operator ++ ()                 -> iterator_base&;
+                auto operator ++ (int)              -> iterator_base;
+                auto operator -- ()                 -> iterator_base&;
+                auto operator -- (int)              -> iterator_base;
                 auto operator += (std::ptrdiff_t n) -> iterator_base&;
+                auto operator -= (std::ptrdiff_t n) -> iterator_base&;
+                auto operator +  (std::ptrdiff_t n) const -> iterator_base;
+                auto operator -  (std::ptrdiff_t n) const -> iterator_base;
+                auto operator -  (const iterator_base& rhs) const -> difference_type;
                 bool operator == (const iterator_base& rhs) const;
+                auto operator <=> (const iterator_base& rhs) const -> std::strong_ordering;
+
+                ///  @note  Defined here, since a friend of a member class template can not be
+                ///         defined outside of the class.
+                friend auto operator + (std::ptrdiff_t       n,
+                                        const iterator_base& iter) -> iterator_base
+                  {
+                    return iter+n;
+                  }
 //
 //  Accessors ...
 //
               public:
                 IterImageT* Image() const;
                 ISL::Image::Coordinates Coordinates() const;
+              private:
+                auto Index() const -> difference_type;
+                auto MoveTo(difference_type index) -> iterator_base&;
 //
 //  Data ...
 //
@@ -307,6 +493,143 @@
       }
 
 
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A base class template for the ranges of rows of a DirectImage.
+ *
+ *  A base class for the row_range and const_row_range classes.  The elements of a row
+ *  range are std::span objects covering the part of each buffer row within the image
+ *  bounds, from the top row to the bottom row.  Within a row the pixels are contiguous,
+ *  so a loop over a row needs no end-of-run check and presents a simple loop body to the
+ *  vectorizer.
+ */
+
+        template <typename              PixelT,
+                  ISL::Image::PixelInfo pixInfo>
+        template <typename              RowPixelT,
+                  typename              RowImageT>
+          class DirectImage<PixelT,pixInfo>::row_range_base
+            {
+//
+//  Types ...
+//
+              public:
+                ///  a row of pixels
+                using value_type = std::span<RowPixelT>;
+                ///  a random access iterator over the rows
+                class iterator;
+//
+//  Constructor ...
+//
+              public:
+                explicit row_range_base(RowImageT* image_);
+//
+//  Accessors ...
+//
+              public:
+                auto begin() const -> iterator;
+                auto   end() const -> iterator;
+                auto  size() const -> std::ptrdiff_t;
+                auto operator [] (std::ptrdiff_t n) const -> value_type;
+//
+//  Data ...
+//
+              private:
+                ///  the first pixel of the top row
+                RowPixelT* firstPtr = nullptr;
+                ///  the number of pixels in each row
+                ISL::Image::Size width = 0;
+                ///  the number of rows
+                ISL::Image::Size height = 0;
+                ///  the distance between the first pixels of adjacent rows
+                std::ptrdiff_t stride = 0;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for iterators over the rows of a DirectImage.
+ */
+
+        template <typename              PixelT,
+                  ISL::Image::PixelInfo pixInfo>
+        template <typename              RowPixelT,
+                  typename              RowImageT>
+          class DirectImage<PixelT,pixInfo>::row_range_base<RowPixelT,RowImageT>::iterator
+            {
+//
+//  Types ...
+//
+              public:
+                ///  @brief  only input iteration, since rows are produced by value
+                ///  @note   As for the standard views, the iterator concept is stronger.
+                using iterator_category = std::input_iterator_tag;
+                ///  the iterator concept, for ranges and constrained algorithms
+                using iterator_concept = std::random_access_iterator_tag;
+                ///  dereferencing produces a row of pixels
+                using value_type = std::span<RowPixelT>;
+                ///  distance between rows in an image
+                using difference_type = std::ptrdiff_t;
+                ///  rows are produced by value
+                using reference = value_type;
+//
+//  Constructor ...
+//
+              public:
+                iterator();
+                iterator(RowPixelT*       rowPtr_,
+                         ISL::Image::Size width_,
+                         std::ptrdiff_t   stride_);
+//
+//  Operators ...
+//
+              public:
+                auto operator *  () const -> reference;
+                auto operator [] (std::ptrdiff_t n) const -> reference;
+                auto operator ++ ()                 -> iterator&;
+                auto operator ++ (int)              -> iterator;
+                auto operator -- ()                 -> iterator&;
+                auto operator -- (int)              -> iterator;
+                auto operator += (std::ptrdiff_t n) -> iterator&;
+                auto operator -= (std::ptrdiff_t n) -> iterator&;
+                auto operator +  (std::ptrdiff_t n) const -> iterator;
+                auto operator -  (std::ptrdiff_t n) const -> iterator;
+                auto operator -  (const iterator& rhs) const -> difference_type;
+                bool operator == (const iterator& rhs) const;
+                auto operator <=> (const iterator& rhs) const -> std::strong_ordering;
+
+                ///  @note  Defined here, since a friend of a member class template can not be
+                ///         defined outside of the class.
+                friend auto operator + (std::ptrdiff_t  n,
+                                        const iterator& iter) -> iterator
+                  {
+                    return iter+n;
+                  }
+//
+//  Data ...
+//
+              private:
+                ///  the first pixel of the current row
+                RowPixelT* rowPtr = nullptr;
+                ///  the number of pixels in each row
+                ISL::Image::Size width = 0;
+                ///  the distance between the first pixels of adjacent rows
+                std::ptrdiff_t stride = 0;
+            };
+      }
+
+
 //-----------------------------------------------------------------------------------------------
 //-----------------------------------------------------------------------------------------------
 
@@ -329,6 +652,15 @@
                      const ISL::Image::Bounds&                      dstBounds) const;
                 void PadImage(ISL::Image::DirectImage<PixelT,pixInfo>& dstImage,
                               const ISL::Image::Bounds&                srcBounds) const;
+                void PadHalo(ISL::Image::DirectImage<PixelT,pixInfo>& image,
+                             ISL::Image::Size                         margin) const;
+                PixelT PaddingPixel
+                         (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                          const ISL::Image::Coordinates&                 point) const;
+                PaddedImageView<FillPadder>
+                  PaddedView
+                    (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                     const ISL::Image::Bounds&                      dstBounds) const;
               private:
                 ///  the pixel value with which to pad the image
                 const PixelT pixelValue;
@@ -357,6 +689,15 @@
                      const ISL::Image::Bounds&                      dstBounds) const;
                 void PadImage(ISL::Image::DirectImage<PixelT,pixInfo>& dstImage,
                               const ISL::Image::Bounds&                srcBounds) const;
+                void PadHalo(ISL::Image::DirectImage<PixelT,pixInfo>& image,
+                             ISL::Image::Size                         margin) const;
+                PixelT PaddingPixel
+                         (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                          const ISL::Image::Coordinates&                 point) const;
+                PaddedImageView<MirrorPadder>
+                  PaddedView
+                    (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                     const ISL::Image::Bounds&                      dstBounds) const;
             };
       }
 
@@ -382,6 +723,85 @@
                      const ISL::Image::Bounds&                      dstBounds) const;
                 void PadImage(ISL::Image::DirectImage<PixelT,pixInfo>& dstImage,
                               const ISL::Image::Bounds&                srcBounds) const;
+                void PadHalo(ISL::Image::DirectImage<PixelT,pixInfo>& image,
+                             ISL::Image::Size                         margin) const;
+                PixelT PaddingPixel
+                         (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                          const ISL::Image::Coordinates&                 point) const;
+                PaddedImageView<TilePadder>
+                  PaddedView
+                    (const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage,
+                     const ISL::Image::Bounds&                      dstBounds) const;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for views of images padded without copying.
+ *
+ *  A padded view presents an image as if it had been padded to larger bounds by one of
+ *  the padders, without allocating or copying anything.  A point within the bounds of
+ *  the source image refers to its pixel; any other point is resolved on the fly by the
+ *  padder, to the fill value or to the mirrored or tiled source pixel.
+ *
+ *  Convolutions over a view should split the kernel positions in two.  For positions
+ *  within InteriorBounds, every pixel under the kernel lies within the source image, so
+ *  the kernel can use the source pixel pointers directly, at full speed.  Only the
+ *  positions in the border strips around the interior, O(W+H) of them for a small
+ *  kernel, need the slower Pixel function.  Materialize produces the image which the
+ *  padder's PaddedImage function would have produced.  SubView returns a view of the same
+ *  source image and padder with smaller bounds, which must lie within the bounds of the
+ *  view, or std::out_of_range is thrown; since the padder resolves points relative to the
+ *  source image, the sub-view has the same pixels, so a convolution can be tiled over it.
+ *
+ *  Pixel accepts any point within the bounds of the view.  PixelPtr points into the
+ *  source image, so the point must lie within Source().Bounds(); padding pixels, e.g.,
+ *  the fill value of a FillPadder, have no pixel to point to, and std::out_of_range is
+ *  thrown for any other point.
+ */
+
+        template <typename              PixelT,
+                  ISL::Image::PixelInfo pixInfo>
+        template <typename              PadderT>
+          class DirectImage<PixelT,pixInfo>::PaddedImageView
+            {
+//
+//  Constructor ...
+//
+              public:
+                PaddedImageView(const ISL::Image::DirectImage<PixelT,pixInfo>& srcImage_,
+                                const ISL::Image::Bounds&                      bounds_,
+                                const PadderT&                                 padder_);
+//
+//  Accessors ...
+//
+              public:
+                const ISL::Image::Bounds& Bounds() const;
+                const ISL::Image::DirectImage<PixelT,pixInfo>& Source() const;
+                ISL::Image::Bounds InteriorBounds(const ISL::Image::Bounds& kernelBounds) const;
+                bool IsInterior(const ISL::Image::Coordinates& point) const;
+
+                PixelT Pixel(const ISL::Image::Coordinates& point) const;
+                const PixelT* PixelPtr(const ISL::Image::Coordinates& point) const;
+
+                PaddedImageView SubView(const ISL::Image::Bounds& subBounds) const;
+                ISL::Image::DirectImage<PixelT,pixInfo> Materialize() const;
+//
+//  Data ...
+//
+              private:
+                ///  the source image, sharing its buffer
+                const ISL::Image::DirectImage<PixelT,pixInfo> srcImage;
+                ///  the bounds of the padded view
+                const ISL::Image::Bounds bounds;
+                ///  the padder which resolves points outside of the source image
+                const PadderT padder;
             };
       }
 
@@ -423,4 +843,151 @@
                            const FunctionT& function);
       }
 
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The destination image transform functions ...
+//
+//  These write into an existing image.  If the destination image is writable, i.e.,
+//  unique and not read-only, and has the bounds of the source images, the results are
+//  written into its buffer, with no allocation; otherwise the destination is given a new
+//  buffer, and any buffer it shared, or its read-only buffer, is left unmodified.  The new
+//  buffer has the destination's margin, Margin(), and the allocation policy of its old
+//  buffer, so PadHalo still works on it and the row layout is kept.  The destination
+//  may also be a source image.  In the variadic forms the function precedes
+//  the images, since a function parameter pack must be last.
+//
+
+    namespace ISL::Image
+      {
+        template <typename ImageT,
+                  typename FunctionT>
+          void TransformInPlace(ImageT&          image,
+                                const FunctionT& function);
+
+        template <typename ImageT,
+                  typename FunctionT>
+          void TransformInto(ImageT&          dstImage,
+                             const ImageT&    srcImage,
+                             const FunctionT& function);
+
+        template <typename ImageT,
+                  typename FunctionT>
+          void TransformInto(ImageT&          dstImage,
+                             const ImageT&    srcImage1,
+                             const ImageT&    srcImage2,
+                             const FunctionT& function);
+
+        template <typename    ImageT,
+                  typename    FunctionT,
+                  typename... SrcImagesT>
+            requires std::invocable<const FunctionT&,
+                                    const typename SrcImagesT::Pixel&...>
+          void TransformInto(ImageT&              dstImage,
+                             const FunctionT&     function,
+                             const SrcImagesT&... srcImages);
+
+        template <typename    FunctionT,
+                  typename    ImageT,
+                  typename... ImagesT>
+            requires std::invocable<const FunctionT&,
+                                    const typename ImageT::Pixel&,
+                                    const typename ImagesT::Pixel&...>
+          ImageT Transform(const FunctionT& function,
+                           const ImageT&    image,
+                           const ImagesT&... images);
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The span image transform functions ...
+//
+//  A span function is passed contiguous runs of pixels rather than single pixels: the whole
+//  image when its pixels are contiguous, otherwise one row at a time.  Its loop body has no
+//  per-pixel end-of-run check, so it can be auto-vectorized, or it can use explicit SIMD
+//  kernels selected by ISL::Image::Dispatch.  The parallel overloads pass a span function
+//  the rows of each tile.
+//
+
+    namespace ISL::Image
+      {
+        ///  a function transforming a run of pixels of one image
+        template <typename FunctionT,
+                  typename PixelT>
+          concept UnarySpanFunction = std::invocable<const FunctionT&,
+                                                     std::span<const PixelT>,
+                                                     std::span<PixelT>>;
+
+        ///  a function transforming corresponding runs of pixels of two images
+        template <typename FunctionT,
+                  typename PixelT>
+          concept BinarySpanFunction = std::invocable<const FunctionT&,
+                                                      std::span<const PixelT>,
+                                                      std::span<const PixelT>,
+                                                      std::span<PixelT>>;
+
+        template <typename ImageT,
+                  typename FunctionT>
+            requires ISL::Image::UnarySpanFunction<FunctionT,typename ImageT::Pixel>
+          ImageT Transform(const ImageT&    image,
+                           const FunctionT& function);
+
+        template <typename ImageT,
+                  typename FunctionT>
+            requires ISL::Image::BinarySpanFunction<FunctionT,typename ImageT::Pixel>
+          ImageT Transform(const ImageT&    image1,
+                           const ImageT&    image2,
+                           const FunctionT& function);
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The parallel image transform functions ...
+//
+//  These divide the image into the tiles of the schedule, and transform the tiles
+//  according to the execution policy.  With std::execution::seq the tiles are
+//  transformed in order by the calling thread, whatever the schedule's thread count.
+//  With std::execution::par they are transformed concurrently by the threads of the
+//  schedule, each tile serially.  With std::execution::par_unseq, or unseq, the pixels
+//  within a tile may also be transformed in any order, interleaved in SIMD lanes, so the
+//  function must not synchronize, e.g., lock a mutex.  Images smaller than the schedule's
+//  serial threshold are transformed by the calling thread under any policy.  Except with
+//  seq, the function is called concurrently from several threads, for different pixels,
+//  so it must be safe to call concurrently and must not modify shared state without
+//  synchronization.  A span function is passed the rows of a tile, one at a time.  The
+//  results are the same under every policy.
+//
+
+    namespace ISL::Image
+      {
+        template <typename ExecutionPolicyT,
+                  typename ImageT,
+                  typename FunctionT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+          ImageT Transform(ExecutionPolicyT&&              policy,
+                           const ImageT&                   image,
+                           const FunctionT&                function,
+                           const ISL::Image::TileSchedule& schedule
+                                                             = ISL::Image::TileSchedule());
+
+        template <typename ExecutionPolicyT,
+                  typename ImageT,
+                  typename FunctionT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+          ImageT Transform(ExecutionPolicyT&&              policy,
+                           const ImageT&                   image1,
+                           const ImageT&                   image2,
+                           const FunctionT&                function,
+                           const ISL::Image::TileSchedule& schedule
+                                                             = ISL::Image::TileSchedule());
+      }
+
   #endif
@@ -0,0 +1,204 @@
+/**
+ *  @file  FftConvolution.hpp
+ *
+ *  @brief  Convolution with large kernels using the fast Fourier transform.
+ *
+ *  Convolution with large kernels using the fast Fourier transform.
+ */
+
+  #ifndef   ISL_IMAGE_FFT_CONVOLUTION_HPP_INCLUDED
+    #define ISL_IMAGE_FFT_CONVOLUTION_HPP_INCLUDED
+
+    #include <ISL/Image/CompiledKernel.hpp>
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <complex>
+    #include <memory>
+    #include <vector>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  An interface to an implementation of the two-dimensional real FFT.
+ *
+ *  The forward transform of a WxH real array produces the (W/2+1)xH non-redundant
+ *  complex coefficients, in raster order; the inverse transform is unnormalized, i.e.,
+ *  the inverse of the forward transform multiplies the array by W*H.  GoodSize returns
+ *  the smallest size, not less than its argument, which the implementation transforms
+ *  efficiently.  An implementation must allow concurrent transforms from several threads.
+ */
+
+        class FftProvider
+          {
+//
+//  Constructors and destructor ...
+//
+            public:
+              FftProvider();
+              virtual ~FftProvider() { ; }
+
+              FftProvider(const FftProvider&  src) = delete;
+              FftProvider(      FftProvider&& src) = delete;
+
+              FftProvider& operator = (const FftProvider&  rhs) = delete;
+              FftProvider& operator = (      FftProvider&& rhs) = delete;
+//
+//  The transforms ...
+//
+            public:
+              virtual ISL::Image::Size GoodSize(ISL::Image::Size size) const = 0;
+              virtual void Forward(ISL::Image::Size     width,
+                                   ISL::Image::Size     height,
+                                   const float*         src,
+                                   std::complex<float>* dst) const = 0;
+              virtual void Inverse(ISL::Image::Size           width,
+                                   ISL::Image::Size           height,
+                                   const std::complex<float>* src,
+                                   float*                     dst) const = 0;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A self-contained implementation of the two-dimensional real FFT.
+ *
+ *  A mixed-radix (2, 3, 5) implementation, used when no other provider is given; its
+ *  good sizes are the products of powers of 2, 3, and 5.
+ */
+
+        class BuiltInFftProvider : public ISL::Image::FftProvider
+          {
+            public:
+              ISL::Image::Size GoodSize(ISL::Image::Size size) const override;
+              void Forward(ISL::Image::Size     width,
+                           ISL::Image::Size     height,
+                           const float*         src,
+                           std::complex<float>* dst) const override;
+              void Inverse(ISL::Image::Size           width,
+                           ISL::Image::Size           height,
+                           const std::complex<float>* src,
+                           float*                     dst) const override;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class for convolution with large kernels using the FFT.
+ *
+ *  The image is convolved by overlap-save.  The transformed tiles, each an output tile
+ *  extended by the kernel bounds, have the tile size, which is a good FFT size; each
+ *  output tile is thus the tile size minus the kernel extent plus one, in each direction.
+ *  Each extended tile is transformed, multiplied by the kernel spectrum, and inverse
+ *  transformed, keeping the output tile, the part of the result not affected by circular
+ *  wrap-around.  The kernel spectrum is computed once, for the tile size; by default the
+ *  tile size is the good size nearest to four times the kernel extent, which balances
+ *  transform cost against wasted overlap.  A tile size given to the constructor is
+ *  rounded up with the provider's GoodSize; std::invalid_argument is thrown if it is not
+ *  greater than the kernel extent minus one, in either direction, since the output tiles
+ *  would then be empty.  Tiles are independent, and are processed in parallel according
+ *  to the tile schedule.
+ *
+ *  Tiles which extend beyond the source image read through a padded view with the given
+ *  padder, so the boundary handling is that of the FillPadder, MirrorPadder, or
+ *  TilePadder, exactly as for direct convolution of the padded image.  The results
+ *  differ from those of direct convolution only by floating point rounding.
+ */
+
+        class FftConvolver
+          {
+//
+//  Constructors ...
+//
+            public:
+              explicit FftConvolver(const std::vector<ISL::Image::KernelTap<float>>& taps);
+              FftConvolver(const std::vector<ISL::Image::KernelTap<float>>& taps,
+                           std::shared_ptr<const ISL::Image::FftProvider>   provider_,
+                           ISL::Image::Size                                 tileSize_);
+//
+//  Accessors ...
+//
+            public:
+              ISL::Image::Bounds Bounds() const;
+              ISL::Image::Size TileSize() const;
+//
+//  Convolution ...
+//
+            public:
+              template <typename ImageT,
+                        typename PadderT>
+                ImageT Convolve(const ImageT&                   srcImage,
+                                const PadderT&                  padder,
+                                const ISL::Image::TileSchedule& schedule) const;
+//
+//  Data ...
+//
+            private:
+              ///  the FFT implementation
+              std::shared_ptr<const ISL::Image::FftProvider> provider;
+              ///  the bounds of the kernel relative to its origin
+              ISL::Image::Bounds bounds;
+              ///  the width and height of the transformed, extended tiles; a good FFT size
+              ISL::Image::Size tileSize = 0;
+              ///  the spectrum of the kernel, for the tile size
+              std::vector<std::complex<float>> spectrum;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The convolution method selection functions ...
+//
+//  ChooseConvolutionMethod estimates the costs of direct convolution, proportional to the
+//  number of kernel taps, and of FFT convolution, proportional to the logarithm of the
+//  tile size plus the overlap overhead, per output pixel, and chooses the cheaper; the
+//  crossover is typically near 15x15 kernels.  Convolve uses it to convolve with either a
+//  compiled kernel or an FFT convolver, with the same boundary handling; both read the
+//  source through a padded view, so neither copies the image to pad it, and both are
+//  tiled and parallel according to the schedule, the compiled kernel over sub-views of
+//  the padded view.
+//
+
+    namespace ISL::Image
+      {
+        ///  the methods of convolution
+        enum class ConvolutionMethod
+          {
+            Direct,  ///<  direct summation of the kernel taps
+            Fft      ///<  multiplication of the spectra
+          };
+
+        ISL::Image::ConvolutionMethod
+          ChooseConvolutionMethod(std::ptrdiff_t            tapCount,
+                                  const ISL::Image::Bounds& kernelBounds,
+                                  const ISL::Image::Bounds& imageBounds);
+
+        template <typename ImageT,
+                  typename PadderT>
+          ImageT Convolve(const ImageT&                                    srcImage,
+                          const std::vector<ISL::Image::KernelTap<float>>& taps,
+                          const PadderT&                                   padder,
+                          const ISL::Image::TileSchedule&                  schedule);
+      }
+
+  #endif
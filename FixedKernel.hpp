@@ -0,0 +1,203 @@
+/**
+ *  @file  FixedKernel.hpp
+ *
+ *  @brief  A class template for convolution kernels fixed at compile time.
+ *
+ *  A class template for convolution kernels fixed at compile time.
+ */
+
+  #ifndef   ISL_IMAGE_FIXED_KERNEL_HPP_INCLUDED
+    #define ISL_IMAGE_FIXED_KERNEL_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TiledConvolution.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <array>
+    #include <type_traits>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  The geometry and weights of a kernel fixed at compile time.
+ *
+ *  The weights of a WxH kernel in raster order; a weight of zero means that the position
+ *  is not part of the kernel geometry, so non-rectangular geometries, e.g., crosses and
+ *  diamonds, are expressed with zeros.  The weighted sum is divided by the divisor, so
+ *  integer weights can express normalized kernels, e.g., the binomial kernel with
+ *  weights summing to 16 and a divisor of 16.  This is a structural type, so its values
+ *  can be template arguments.
+ */
+
+        template <typename WeightT,
+                  int      width,
+                  int      height>
+          struct FixedWeights
+            {
+              ///  the weight type
+              using Weight = WeightT;
+
+              ///  the weights, in raster order
+              std::array<WeightT,width*height> weights;
+              ///  the positive divisor of the weighted sum
+              int divisor = 1;
+              ///  the horizontal position of the kernel origin within the weights
+              int originX = width/2;
+              ///  the vertical position of the kernel origin within the weights
+              int originY = height/2;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for convolution kernels fixed at compile time.
+ *
+ *  Since the geometry and weights are template arguments, the tap loop is unrolled
+ *  completely at compile time: zero weights generate no code, unit weights generate no
+ *  multiplication, and, for integer weights and pixels, power-of-two weights generate
+ *  shifts.  The resulting straight-line code is vectorized across output pixels.  For
+ *  kernels known only at run time, use the compiled or separable kernels.
+ *
+ *  Products and sums are computed in the accumulator type, the common type of the weight
+ *  and pixel types, std::common_type_t<Weight,PixelT>, so the integer weights of the
+ *  predefined kernels applied to a float image accumulate in float.  The division by the
+ *  divisor is also resolved at compile time.  When both the accumulator and destination
+ *  pixel types are integral, the sum is divided rounding to nearest, ties upward, i.e.,
+ *  floor((sum+divisor/2)/divisor): a power-of-two divisor is a rounding shift, and any
+ *  other divisor a multiplication by its fixed-point reciprocal and a shift, exact for
+ *  every sum the kernel can produce.  Otherwise the division is exact, a multiplication
+ *  by the reciprocal of the divisor, which for floating point weights is folded into
+ *  the weights, so it costs nothing.
+ *
+ *  The source image must cover the destination bounds extended by the kernel bounds.
+ *  Integer destination pixels are rounded and clamped to the range of the pixel type.
+ *  Apply returns the weighted sum at one position, before the division.  Convolve tiles
+ *  the destination according to the schedule, or a default schedule, with
+ *  ISL::Image::ConvolveTiled; ConvolveTile computes a single tile serially, into the
+ *  destination's existing buffer, shared or not, without reallocating it.
+ */
+
+        template <ISL::Image::FixedWeights fixedWeights>
+          class FixedKernel
+            {
+//
+//  Types ...
+//
+              public:
+                ///  the weight type
+                using Weight = typename decltype(fixedWeights)::Weight;
+//
+//  Accessors ...
+//
+              public:
+                static constexpr int TapCount();
+                static ISL::Image::Bounds Bounds();
+//
+//  Convolution ...
+//
+              public:
+                template <typename PixelT>
+                  static std::common_type_t<Weight,PixelT> Apply(const PixelT*  originPtr,
+                                                                 std::ptrdiff_t rowStride);
+
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  static void Convolve(const SrcImageT& srcImage,
+                                       DstImageT&       dstImage);
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  static void Convolve(const SrcImageT&                srcImage,
+                                       DstImageT&                      dstImage,
+                                       const ISL::Image::TileSchedule& schedule);
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  static void ConvolveTile(const SrcImageT& srcImage,
+                                           DstImageT&       dstImage);
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  Common fixed kernels ...
+//
+
+    namespace ISL::Image
+      {
+        ///  the 3x3 box kernel, normalized
+        inline constexpr auto box3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            .weights = { 1, 1, 1,
+                         1, 1, 1,
+                         1, 1, 1 },
+            .divisor = 9
+          };
+
+        ///  the 3x3 binomial kernel, normalized
+        inline constexpr auto binomial3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            .weights = { 1, 2, 1,
+                         2, 4, 2,
+                         1, 2, 1 },
+            .divisor = 16
+          };
+
+        ///  the 3x3 cross kernel
+        inline constexpr auto cross3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            { 0, 1, 0,
+              1, 1, 1,
+              0, 1, 0 }
+          };
+
+        ///  the 5x5 diamond kernel
+        inline constexpr auto diamond5x5 = ISL::Image::FixedWeights<int,5,5>
+          {
+            { 0, 0, 1, 0, 0,
+              0, 1, 1, 1, 0,
+              1, 1, 1, 1, 1,
+              0, 1, 1, 1, 0,
+              0, 0, 1, 0, 0 }
+          };
+
+        ///  the 3x3 Laplacian kernel
+        inline constexpr auto laplacian3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            { 0,  1, 0,
+              1, -4, 1,
+              0,  1, 0 }
+          };
+
+        ///  the 3x3 Sobel kernel for the derivative in the x direction
+        inline constexpr auto sobelX3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            { -1, 0, 1,
+              -2, 0, 2,
+              -1, 0, 1 }
+          };
+
+        ///  the 3x3 Sobel kernel for the derivative in the y direction
+        inline constexpr auto sobelY3x3 = ISL::Image::FixedWeights<int,3,3>
+          {
+            { -1, -2, -1,
+               0,  0,  0,
+               1,  2,  1 }
+          };
+      }
+
+  #endif
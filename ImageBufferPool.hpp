@@ -0,0 +1,164 @@
+/**
+ *  @file  ImageBufferPool.hpp
+ *
+ *  @brief  A memory resource which recycles image buffers.
+ *
+ *  A memory resource which recycles image buffers.
+ */
+
+  #ifndef   ISL_IMAGE_IMAGE_BUFFER_POOL_HPP_INCLUDED
+    #define ISL_IMAGE_IMAGE_BUFFER_POOL_HPP_INCLUDED
+
+    #include <atomic>
+    #include <memory>
+    #include <memory_resource>
+    #include <mutex>
+    #include <vector>
+
+    #include <cstddef>
+    #include <cstdint>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A memory resource which recycles image buffers.
+ *
+ *  A pool for pipelines which repeatedly create and destroy images of the same sizes.  It
+ *  is used by naming it as the memory resource of an ISL::Image::AllocationPolicy; when
+ *  the reference count of a buffer allocated from the pool is decremented to zero, the
+ *  buffer is returned to the pool rather than to the upstream resource, and is handed out
+ *  again by the next allocation of the same size class and alignment.  The size classes
+ *  divide each power of two into eight steps, so a buffer is never more than 12.5% larger
+ *  than the request.
+ *
+ *  Each thread keeps a small cache of released buffers for each pool it uses, so
+ *  allocating and releasing a buffer on the same thread takes only the cache's own lock,
+ *  which is uncontended except while the pool drains the cache; cache overflows and
+ *  misses go to the shared buckets, which are protected by the pool's mutex.  The pool
+ *  keeps a registry of its thread caches, each shared by the registry and a thread_local
+ *  list of the thread's caches.  When a thread exits, its caches are drained into the
+ *  shared buckets of their pools and removed from the registries.  When a pool is
+ *  destroyed first, it drains every registered cache, taking each cache's lock, and
+ *  detaches it, so the exiting thread later finds the cache detached and only frees it.
+ *
+ *  Released buffers are retained subject to the trim policy.  Trim drains the thread
+ *  caches into the shared buckets and then returns the excess to the upstream resource;
+ *  Release, and the destructor, return all of the retained buffers, including those in
+ *  the thread caches of every thread.  The retained bytes of the statistics include the
+ *  buffers in the thread caches.  The upstream resource defaults to
+ *  std::pmr::new_delete_resource().  The pool must outlive the images whose buffers it
+ *  holds.
+ */
+
+        class ImageBufferPool : public std::pmr::memory_resource
+          {
+//
+//  Types ...
+//
+            public:
+              ///  @brief  the usage statistics of a pool
+              struct Statistics
+                {
+                  ///  the number of allocations satisfied with a retained buffer
+                  std::int64_t hits = 0;
+                  ///  the number of allocations passed to the upstream resource
+                  std::int64_t misses = 0;
+                  ///  the number of bytes in buffers currently handed out
+                  std::ptrdiff_t outstandingBytes = 0;
+                  ///  the number of bytes in buffers currently retained, in all caches
+                  std::ptrdiff_t retainedBytes = 0;
+                  ///  the largest number of bytes ever allocated from the upstream resource
+                  std::ptrdiff_t highWaterBytes = 0;
+                };
+
+              ///  @brief  the limits on the buffers retained by a pool
+              struct TrimPolicy
+                {
+                  ///  the maximum number of bytes in retained buffers
+                  std::ptrdiff_t maxRetainedBytes = std::ptrdiff_t(1) << 30;
+                  ///  the maximum number of retained buffers in each size class
+                  int maxBuffersPerClass = 16;
+                  ///  the maximum number of buffers in the cache of each thread
+                  int maxBuffersPerThread = 4;
+                  ///  trim automatically whenever a released buffer exceeds the limits?
+                  bool trimOnRelease = true;
+                };
+
+            private:
+              ///  the shared buckets of retained buffers
+              class Buckets;
+              ///  @brief  the cache of retained buffers of one thread
+              ///  @note   Holds its own mutex, and a pointer to the pool which is cleared
+              ///          when the pool detaches it.
+              class ThreadCache;
+//
+//  Constructors and destructor ...
+//
+            public:
+              ImageBufferPool();
+              explicit ImageBufferPool(const TrimPolicy&          trimPolicy_);
+              ImageBufferPool(const TrimPolicy&          trimPolicy_,
+                              std::pmr::memory_resource* upstream_);
+              ~ImageBufferPool() override;
+
+              ImageBufferPool(const ImageBufferPool&  src) = delete;
+              ImageBufferPool(      ImageBufferPool&& src) = delete;
+
+              ImageBufferPool& operator = (const ImageBufferPool&  rhs) = delete;
+              ImageBufferPool& operator = (      ImageBufferPool&& rhs) = delete;
+//
+//  Accessors ...
+//
+            public:
+              Statistics CurrentStatistics() const;
+              const TrimPolicy& Policy() const;
+              std::pmr::memory_resource* Upstream() const;
+//
+//  Mutators ...
+//
+            public:
+              void Trim();
+              void Release();
+//
+//  The memory resource interface ...
+//
+            private:
+              void* do_allocate(std::size_t bytes,
+                                std::size_t alignment) override;
+              void do_deallocate(void*       ptr,
+                                 std::size_t bytes,
+                                 std::size_t alignment) override;
+              bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+//
+//  Data ...
+//
+            private:
+              ///  the limits on the retained buffers
+              const TrimPolicy trimPolicy;
+              ///  the resource from which buffers are allocated on a miss
+              std::pmr::memory_resource* const upstream;
+              ///  protects the shared buckets and the registry of thread caches
+              mutable std::mutex mutex;
+              ///  the shared buckets of retained buffers
+              std::unique_ptr<Buckets> buckets;
+              ///  the registry of the thread caches of this pool, protected by the mutex
+              std::vector<std::shared_ptr<ThreadCache>> threadCaches;
+              ///  the number of allocations satisfied with a retained buffer
+              std::atomic<std::int64_t> hits = 0;
+              ///  the number of allocations passed to the upstream resource
+              std::atomic<std::int64_t> misses = 0;
+              ///  the number of bytes in buffers currently handed out
+              std::atomic<std::ptrdiff_t> outstandingBytes = 0;
+              ///  the number of bytes in buffers currently retained, including thread caches
+              std::atomic<std::ptrdiff_t> retainedBytes = 0;
+              ///  the largest number of bytes ever allocated from the upstream resource
+              std::atomic<std::ptrdiff_t> highWaterBytes = 0;
+          };
+      }
+
+  #endif
@@ -0,0 +1,336 @@
+/**
+ *  @file  ImageExpression.hpp
+ *
+ *  @brief  Class templates for lazily evaluated image expressions.
+ *
+ *  Class templates for lazily evaluated image expressions.
+ */
+
+  #ifndef   ISL_IMAGE_IMAGE_EXPRESSION_HPP_INCLUDED
+    #define ISL_IMAGE_IMAGE_EXPRESSION_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+
+    #include <functional>
+    #include <type_traits>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A base class template for lazily evaluated image expressions.
+ *
+ *  An image expression describes how to compute the pixels of an image without computing
+ *  them.  Expressions are built from images with Lazy, and are combined with LazyTransform
+ *  and with the arithmetic operators; each node holds its operands by value, and the
+ *  terminal nodes hold copies of their images, which share the image buffers, so an
+ *  expression may safely outlive the full expression which created it.
+ *
+ *  An expression is evaluated only when it is assigned to, or used to construct, a
+ *  DirectImage.  The whole expression is then evaluated in a single pass over the
+ *  destination, one row at a time: each node provides a row evaluator, and the pixel
+ *  value at each destination coordinate is computed by calling the row evaluators of the
+ *  whole expression tree, so no intermediate images are allocated and each source pixel
+ *  is read once.  Intermediate values have the types produced by the node functions;
+ *  conversion to the destination pixel type happens once, when the expression is
+ *  evaluated.  Assignment writes into the buffer of the destination if it is writable,
+ *  i.e., unique and not read-only, and has the bounds of the expression; otherwise the
+ *  destination is given a new buffer, with its margin and allocation policy, as by
+ *  TransformInto.  The template argument is the derived expression type.
+ */
+
+        template <typename ExpressionT>
+          class ImageExpression
+            {
+//
+//  Accessors ...
+//
+              public:
+                const ExpressionT& Expression() const;
+                const ISL::Image::Bounds& Bounds() const;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for image expressions which are images.
+ */
+
+        template <typename ImageT>
+          class ImageTerminal
+            : public ISL::Image::ImageExpression<ImageTerminal<ImageT>>
+            {
+              public:
+                ///  the pixel type of the expression
+                using Pixel = typename ImageT::Pixel;
+                ///  @brief  an evaluator for one row of the expression
+                ///  @note   Provides Pixel operator [] (ISL::Image::Coordinate x) const.
+                class Row;
+
+              public:
+                explicit ImageTerminal(const ImageT& image_);
+
+                const ISL::Image::Bounds& Bounds() const;
+                Row RowAt(ISL::Image::Coordinate y) const;
+
+              private:
+                ///  a copy of the image, sharing its buffer
+                const ImageT image;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for image expressions with a constant value.
+ *
+ *  A constant expression has no bounds of its own; it takes the bounds of the expression
+ *  with which it is combined.
+ */
+
+        template <typename ValueT>
+          class ConstantTerminal
+            : public ISL::Image::ImageExpression<ConstantTerminal<ValueT>>
+            {
+              public:
+                ///  the pixel type of the expression
+                using Pixel = ValueT;
+                ///  @brief  an evaluator for one row of the expression
+                ///  @note   Provides Pixel operator [] (ISL::Image::Coordinate x) const.
+                class Row;
+
+              public:
+                explicit ConstantTerminal(const ValueT& value_);
+
+                Row RowAt(ISL::Image::Coordinate y) const;
+
+              private:
+                ///  the constant value
+                const ValueT value;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for image expressions applying a function to the pixels of
+ *          one expression.
+ */
+
+        template <typename ArgT,
+                  typename FunctionT>
+          class UnaryExpression
+            : public ISL::Image::ImageExpression<UnaryExpression<ArgT,FunctionT>>
+            {
+              public:
+                ///  the pixel type of the expression
+                using Pixel = std::invoke_result_t<const FunctionT&,
+                                                   typename ArgT::Pixel>;
+                ///  @brief  an evaluator for one row of the expression
+                ///  @note   Provides Pixel operator [] (ISL::Image::Coordinate x) const.
+                class Row;
+
+              public:
+                UnaryExpression(const ArgT&      arg_,
+                                const FunctionT& function_);
+
+                const ISL::Image::Bounds& Bounds() const;
+                Row RowAt(ISL::Image::Coordinate y) const;
+
+              private:
+                ///  the argument expression
+                const ArgT arg;
+                ///  the function applied to each pixel of the argument
+                const FunctionT function;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for image expressions applying a function to corresponding
+ *          pixels of two expressions.
+ *
+ *  The bounds of the two expressions must be equal, unless one of them is a constant.
+ */
+
+        template <typename Arg1T,
+                  typename Arg2T,
+                  typename FunctionT>
+          class BinaryExpression
+            : public ISL::Image::ImageExpression<BinaryExpression<Arg1T,Arg2T,FunctionT>>
+            {
+              public:
+                ///  the pixel type of the expression
+                using Pixel = std::invoke_result_t<const FunctionT&,
+                                                   typename Arg1T::Pixel,
+                                                   typename Arg2T::Pixel>;
+                ///  @brief  an evaluator for one row of the expression
+                ///  @note   Provides Pixel operator [] (ISL::Image::Coordinate x) const.
+                class Row;
+
+              public:
+                BinaryExpression(const Arg1T&     arg1_,
+                                 const Arg2T&     arg2_,
+                                 const FunctionT& function_);
+
+                const ISL::Image::Bounds& Bounds() const;
+                Row RowAt(ISL::Image::Coordinate y) const;
+
+              private:
+                ///  the first argument expression
+                const Arg1T arg1;
+                ///  the second argument expression
+                const Arg2T arg2;
+                ///  the function applied to corresponding pixels of the arguments
+                const FunctionT function;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The expression factory functions ...
+//
+
+    namespace ISL::Image
+      {
+        template <typename ImageT>
+          ISL::Image::ImageTerminal<ImageT> Lazy(const ImageT& image);
+
+        template <typename ArgT,
+                  typename FunctionT>
+          ISL::Image::UnaryExpression<ArgT,FunctionT>
+            LazyTransform(const ISL::Image::ImageExpression<ArgT>& arg,
+                          const FunctionT&                         function);
+
+        template <typename Arg1T,
+                  typename Arg2T,
+                  typename FunctionT>
+          ISL::Image::BinaryExpression<Arg1T,Arg2T,FunctionT>
+            LazyTransform(const ISL::Image::ImageExpression<Arg1T>& arg1,
+                          const ISL::Image::ImageExpression<Arg2T>& arg2,
+                          const FunctionT&                          function);
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The expression operators ...
+//
+//  The binary operators combine two expressions, or an expression and a scalar on either
+//  side, e.g., 255 - Lazy(image) inverts and 1.0 / Lazy(image) takes the reciprocal of
+//  each pixel; unary minus negates each pixel.
+//
+
+    namespace ISL::Image
+      {
+        template <typename Arg1T,
+                  typename Arg2T>
+          ISL::Image::BinaryExpression<Arg1T,Arg2T,std::plus<>>
+            operator + (const ISL::Image::ImageExpression<Arg1T>& arg1,
+                        const ISL::Image::ImageExpression<Arg2T>& arg2);
+        template <typename Arg1T,
+                  typename Arg2T>
+          ISL::Image::BinaryExpression<Arg1T,Arg2T,std::minus<>>
+            operator - (const ISL::Image::ImageExpression<Arg1T>& arg1,
+                        const ISL::Image::ImageExpression<Arg2T>& arg2);
+        template <typename Arg1T,
+                  typename Arg2T>
+          ISL::Image::BinaryExpression<Arg1T,Arg2T,std::multiplies<>>
+            operator * (const ISL::Image::ImageExpression<Arg1T>& arg1,
+                        const ISL::Image::ImageExpression<Arg2T>& arg2);
+        template <typename Arg1T,
+                  typename Arg2T>
+          ISL::Image::BinaryExpression<Arg1T,Arg2T,std::divides<>>
+            operator / (const ISL::Image::ImageExpression<Arg1T>& arg1,
+                        const ISL::Image::ImageExpression<Arg2T>& arg2);
+
+        template <typename ArgT,
+                  typename ValueT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ArgT,ISL::Image::ConstantTerminal<ValueT>,std::plus<>>
+            operator + (const ISL::Image::ImageExpression<ArgT>& arg,
+                        const ValueT&                            value);
+        template <typename ArgT,
+                  typename ValueT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ArgT,ISL::Image::ConstantTerminal<ValueT>,std::minus<>>
+            operator - (const ISL::Image::ImageExpression<ArgT>& arg,
+                        const ValueT&                            value);
+        template <typename ArgT,
+                  typename ValueT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ArgT,ISL::Image::ConstantTerminal<ValueT>,
+                                       std::multiplies<>>
+            operator * (const ISL::Image::ImageExpression<ArgT>& arg,
+                        const ValueT&                            value);
+        template <typename ArgT,
+                  typename ValueT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ArgT,ISL::Image::ConstantTerminal<ValueT>,
+                                       std::divides<>>
+            operator / (const ISL::Image::ImageExpression<ArgT>& arg,
+                        const ValueT&                            value);
+        template <typename ValueT,
+                  typename ArgT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ISL::Image::ConstantTerminal<ValueT>,ArgT,std::plus<>>
+            operator + (const ValueT&                            value,
+                        const ISL::Image::ImageExpression<ArgT>& arg);
+        template <typename ValueT,
+                  typename ArgT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ISL::Image::ConstantTerminal<ValueT>,ArgT,std::minus<>>
+            operator - (const ValueT&                            value,
+                        const ISL::Image::ImageExpression<ArgT>& arg);
+        template <typename ValueT,
+                  typename ArgT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ISL::Image::ConstantTerminal<ValueT>,ArgT,
+                                       std::multiplies<>>
+            operator * (const ValueT&                            value,
+                        const ISL::Image::ImageExpression<ArgT>& arg);
+        template <typename ValueT,
+                  typename ArgT>
+            requires std::is_arithmetic_v<ValueT>
+          ISL::Image::BinaryExpression<ISL::Image::ConstantTerminal<ValueT>,ArgT,
+                                       std::divides<>>
+            operator / (const ValueT&                            value,
+                        const ISL::Image::ImageExpression<ArgT>& arg);
+
+        template <typename ArgT>
+          ISL::Image::UnaryExpression<ArgT,std::negate<>>
+            operator - (const ISL::Image::ImageExpression<ArgT>& arg);
+      }
+
+  #endif
@@ -0,0 +1,60 @@
+/**
+ *  @file  InstructionSet.hpp
+ *
+ *  @brief  Runtime selection of SIMD kernels.
+ *
+ *  Runtime selection of SIMD kernels.
+ */
+
+  #ifndef   ISL_IMAGE_INSTRUCTION_SET_HPP_INCLUDED
+    #define ISL_IMAGE_INSTRUCTION_SET_HPP_INCLUDED
+
+    #include <utility>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  @brief  the instruction sets for which SIMD kernels may be provided, in order of
+        ///          increasing capability
+        ///  @note   Scalar kernels are the reference implementations; every other kernel must
+        ///          produce results identical to them.
+        enum class InstructionSet
+          {
+            Scalar,  ///<  portable C++, possibly auto-vectorized
+            SSE4_2,  ///<  128-bit vectors
+            AVX2,    ///<  256-bit vectors
+            AVX512   ///<  512-bit vectors (F, BW, and VL subsets)
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The instruction set functions ...
+//
+//  The supported instruction set is detected once, from the processor and the operating
+//  system.  The active instruction set is the lesser of the supported instruction set
+//  and the limit, which defaults to the supported instruction set; limiting it to Scalar
+//  allows the SIMD kernels to be verified against the reference kernels.  Dispatch calls
+//  kernel.template Run<set>(args...) for the active instruction set, or for the most
+//  capable lesser set for which the kernel provides a Run function template.
+//
+
+    namespace ISL::Image
+      {
+        ISL::Image::InstructionSet SupportedInstructionSet();
+        ISL::Image::InstructionSet ActiveInstructionSet();
+        void LimitInstructionSet(ISL::Image::InstructionSet limit);
+
+        template <typename    KernelT,
+                  typename... ArgsT>
+          void Dispatch(const KernelT& kernel,
+                        ArgsT&&...     args);
+      }
+
+  #endif
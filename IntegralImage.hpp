@@ -0,0 +1,157 @@
+/**
+ *  @file  IntegralImage.hpp
+ *
+ *  @brief  A class template for integral images (summed-area tables), and the box, mean,
+ *          and variance filters based upon them.
+ *
+ *  A class template for integral images (summed-area tables), and the box, mean, and
+ *  variance filters based upon them.
+ */
+
+  #ifndef   ISL_IMAGE_INTEGRAL_IMAGE_HPP_INCLUDED
+    #define ISL_IMAGE_INTEGRAL_IMAGE_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+    #include <ISL/Support/Option.hpp>
+
+    #include <concepts>
+    #include <string>
+    #include <type_traits>
+    #include <vector>
+
+    #include <cstddef>
+    #include <cstdint>
+
+    ///  option identifier for IncludeSquares
+    extern const std::string Option_IncludeSquares;
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  also sum the squares of the pixel values?
+        using IncludeSquares = ISL::Support::Option<Option_IncludeSquares>;
+
+        ///  @brief  a pixel type whose sums, and sums of squares, an integral image can hold
+        ///  @note   64-bit sums of 16-bit pixels, and of their squares, can not overflow
+        ///          for images of fewer than 2^31 pixels; wider integral pixels could.
+        template <typename PixelT>
+          concept IntegralPixel = std::floating_point<PixelT>
+                                  || (std::integral<PixelT> && sizeof(PixelT) <= 2);
+
+        ///  the type of the sums of an integral image of a pixel type
+        template <ISL::Image::IntegralPixel PixelT>
+          using IntegralSum = std::conditional_t<std::is_integral_v<PixelT>,
+                                                 std::int64_t,
+                                                 double>;
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for integral images (summed-area tables).
+ *
+ *  An integral image holds, for each point, the sum of the pixel values of the source
+ *  image above and to the left of it, and optionally the sum of their squares, so the sum
+ *  over any rectangle is obtained from four table entries in constant time, regardless of
+ *  the size of the rectangle.  The table has one more row and column than the source
+ *  image, with the first row and column zero.
+ *
+ *  The table is built in two parallel passes: prefix sums along the rows, with the rows
+ *  divided among the threads, followed by prefix sums down the columns, with blocks of
+ *  adjacent columns divided among the threads, so each thread reads and writes whole
+ *  cache lines.  The pixels must have a single sample, and be floating point or integral
+ *  of at most 16 bits, so that the 64-bit sums can not overflow.
+ */
+
+        template <ISL::Image::IntegralPixel PixelT>
+          class IntegralImage
+            {
+//
+//  Types ...
+//
+              public:
+                ///  the type of the sums
+                using Sum = ISL::Image::IntegralSum<PixelT>;
+//
+//  Constructor ...
+//
+              public:
+                template <typename ImageT>
+                  IntegralImage(const ImageT&                   image,
+                                ISL::Image::IncludeSquares      includeSquares,
+                                const ISL::Image::TileSchedule& schedule);
+//
+//  Accessors ...
+//
+              public:
+                const ISL::Image::Bounds& Bounds() const;
+                bool HasSquares() const;
+
+                Sum       BoxSum(const ISL::Image::Bounds& window) const;
+                Sum BoxSquareSum(const ISL::Image::Bounds& window) const;
+//
+//  Data ...
+//
+              private:
+                ///  the bounds of the source image
+                ISL::Image::Bounds bounds;
+                ///  the distance between the first entries of adjacent table rows
+                std::ptrdiff_t stride = 0;
+                ///  the table of sums
+                std::vector<Sum> sums;
+                ///  the table of sums of squares, if included
+                std::vector<Sum> squareSums;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The integral image filter functions ...
+//
+//  Each output pixel is computed from the window of the given width and height centered
+//  on it, in constant time for any window size.  The width and height must be odd, so the
+//  window has a center, or std::invalid_argument is thrown.  Windows are clipped to the
+//  image bounds, and the mean and variance are those of the pixels in the clipped window.
+//  The sums are rounded and clamped to the destination pixel type.  VarianceFilter
+//  requires an integral image which includes the squares, or std::invalid_argument is
+//  thrown.  One integral image can serve several filters, e.g., the mean and variance of
+//  an adaptive threshold.
+//
+
+    namespace ISL::Image
+      {
+        template <typename                  DstImageT,
+                  ISL::Image::IntegralPixel PixelT>
+          DstImageT BoxFilter(const ISL::Image::IntegralImage<PixelT>& integralImage,
+                              ISL::Image::Size                         width,
+                              ISL::Image::Size                         height,
+                              const ISL::Image::TileSchedule&          schedule);
+
+        template <typename                  DstImageT,
+                  ISL::Image::IntegralPixel PixelT>
+          DstImageT MeanFilter(const ISL::Image::IntegralImage<PixelT>& integralImage,
+                               ISL::Image::Size                         width,
+                               ISL::Image::Size                         height,
+                               const ISL::Image::TileSchedule&          schedule);
+
+        template <typename                  DstImageT,
+                  ISL::Image::IntegralPixel PixelT>
+          DstImageT VarianceFilter(const ISL::Image::IntegralImage<PixelT>& integralImage,
+                                   ISL::Image::Size                         width,
+                                   ISL::Image::Size                         height,
+                                   const ISL::Image::TileSchedule&          schedule);
+      }
+
+  #endif
@@ -0,0 +1,128 @@
+/**
+ *  @file  LargePageResource.hpp
+ *
+ *  @brief  A memory resource for large image buffers, backed by huge pages.
+ *
+ *  A memory resource for large image buffers, backed by huge pages.
+ */
+
+  #ifndef   ISL_IMAGE_LARGE_PAGE_RESOURCE_HPP_INCLUDED
+    #define ISL_IMAGE_LARGE_PAGE_RESOURCE_HPP_INCLUDED
+
+    #include <memory_resource>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  the kind of pages which back a buffer
+        enum class PageMode
+          {
+            Default,      ///<  the normal page size
+            Transparent,  ///<  transparent huge pages, requested with madvise(MADV_HUGEPAGE)
+            Explicit      ///<  reserved huge pages, mapped with MAP_HUGETLB
+          };
+
+        ///  the placement of the pages of a buffer on the NUMA nodes
+        enum class NumaPlacement
+          {
+            FirstTouch,   ///<  each page on the node of the thread which first touches it
+            Local,        ///<  all pages on the node of the allocating thread
+            Interleaved,  ///<  pages interleaved across all nodes
+            Node          ///<  all pages on a given node
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A memory resource for large image buffers, backed by huge pages.
+ *
+ *  A memory resource which maps each allocation directly with mmap, requesting huge pages
+ *  to reduce TLB misses and binding the pages to NUMA nodes with mbind.  It is used by
+ *  naming it as the memory resource of an ISL::Image::AllocationPolicy, generally only
+ *  for buffers of many megabytes; smaller allocations are passed to the upstream
+ *  resource, which defaults to std::pmr::new_delete_resource().  If explicit huge pages
+ *  are requested but none are available, and fallback is set, the allocation uses
+ *  transparent huge pages instead; otherwise std::bad_alloc is thrown.  On systems
+ *  without these facilities the options are ignored.
+ *
+ *  With first-touch placement a page is placed on the node of the thread which first
+ *  writes to it.  Setting the initialization schedule of the allocation policy to a
+ *  schedule with static tile assignment, and processing with static assignment and the
+ *  same thread count, then places each band of rows of the image on the node of the core
+ *  which will process it.
+ */
+
+        class LargePageResource : public std::pmr::memory_resource
+          {
+//
+//  Types ...
+//
+            public:
+              ///  @brief  the options of a large page resource
+              struct Options
+                {
+                  ///  the kind of pages which back the buffers
+                  ISL::Image::PageMode pageMode = ISL::Image::PageMode::Transparent;
+                  ///  use transparent huge pages if no explicit huge pages are available?
+                  bool fallback = true;
+                  ///  the placement of the pages on the NUMA nodes
+                  ISL::Image::NumaPlacement placement = ISL::Image::NumaPlacement::FirstTouch;
+                  ///  the node used by NumaPlacement::Node
+                  int numaNode = 0;
+                  ///  allocations smaller than this are passed to the upstream resource
+                  std::ptrdiff_t minimumBytes = std::ptrdiff_t(1) << 21;
+                };
+//
+//  Constructors and destructor ...
+//
+            public:
+              LargePageResource();
+              explicit LargePageResource(const Options& options_);
+              LargePageResource(const Options&             options_,
+                                std::pmr::memory_resource* upstream_);
+              ~LargePageResource() override;
+
+              LargePageResource(const LargePageResource&  src) = delete;
+              LargePageResource(      LargePageResource&& src) = delete;
+
+              LargePageResource& operator = (const LargePageResource&  rhs) = delete;
+              LargePageResource& operator = (      LargePageResource&& rhs) = delete;
+//
+//  Accessors ...
+//
+            public:
+              const Options& CurrentOptions() const;
+              std::pmr::memory_resource* Upstream() const;
+//
+//  The memory resource interface ...
+//
+            private:
+              void* do_allocate(std::size_t bytes,
+                                std::size_t alignment) override;
+              void do_deallocate(void*       ptr,
+                                 std::size_t bytes,
+                                 std::size_t alignment) override;
+              bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+//
+//  Data ...
+//
+            private:
+              ///  the options
+              const Options options;
+              ///  the resource from which small buffers are allocated
+              std::pmr::memory_resource* const upstream;
+          };
+      }
+
+  #endif
@@ -0,0 +1,67 @@
+/**
+ *  @file  MappedImage.hpp
+ *
+ *  @brief  Functions to create images backed by memory-mapped files.
+ *
+ *  Functions to create images backed by memory-mapped files.
+ */
+
+  #ifndef   ISL_IMAGE_MAPPED_IMAGE_HPP_INCLUDED
+    #define ISL_IMAGE_MAPPED_IMAGE_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+
+    #include <filesystem>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  the access mode of a memory-mapped image file
+        enum class MapMode
+          {
+            ReadOnly,     ///<  the buffer is read-only; the pixels must not be written
+            CopyOnWrite,  ///<  modified pages are private to the process
+            Shared        ///<  modifications are written to the file
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The mapped image functions ...
+//
+//  MapImageFile creates an image whose buffer is a memory mapping of a raw file of packed
+//  pixels, starting at the given byte offset, with the given bounds as both the image and
+//  the buffer bounds.  Nothing is read when the image is created; pages are read on
+//  demand, and cached, by the operating system, so even very large files open at once.
+//  The image uses the mapping as an externally managed buffer; its release callback
+//  unmaps the file when the last image sharing the buffer is destroyed, and the file may
+//  be closed, or even deleted, while it is mapped.  Clones and unique copies are ordinary
+//  heap images.  The buffer of a read-only mapping is marked read-only, so the image is
+//  never writable: the operations which write into an existing buffer give the image a
+//  new buffer first, or throw, but reading, including through the non-const accessors,
+//  never copies the file.  Pixels must not be written through the accessors of a
+//  read-only mapping.  To write pixels privately, use MapMode::CopyOnWrite, whose private
+//  mapping copies only the pages which are written, rather than MakeUnique, which copies
+//  the whole file; see ISL::Image::DirectImage.  A std::system_error is thrown if the
+//  file can not be opened or mapped, and a std::invalid_argument if the file is too small
+//  for the bounds.
+//
+
+    namespace ISL::Image
+      {
+        template <typename ImageT>
+          ImageT MapImageFile(const std::filesystem::path& path,
+                              const ISL::Image::Bounds&    bounds,
+                              std::ptrdiff_t               offset,
+                              ISL::Image::MapMode          mapMode);
+      }
+
+  #endif
@@ -0,0 +1,194 @@
+/**
+ *  @file  PixelConversion.hpp
+ *
+ *  @brief  Functions to convert runs of pixels between pixel types.
+ *
+ *  Functions to convert runs of pixels between pixel types.
+ */
+
+  #ifndef   ISL_IMAGE_PIXEL_CONVERSION_HPP_INCLUDED
+    #define ISL_IMAGE_PIXEL_CONVERSION_HPP_INCLUDED
+
+    #include <ISL/Image/InstructionSet.hpp>
+
+    #include <array>
+    #include <optional>
+    #include <ratio>
+
+    #include <cstddef>
+    #include <cstdint>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  @brief  a 16-bit (IEEE 754 binary16) floating point sample, as stored in a buffer
+        struct Half
+          {
+            ///  the encoded value
+            std::uint16_t bits = 0;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A scale factor for integer pixels in fixed point.
+ *
+ *  A fixed-point scale applies a scale factor to an integer x, in integer SIMD lanes with
+ *  no floating point, by computing the product p = x*multiplier and rounding p/2^shift to
+ *  nearest, ties to even, as the floating point reference does.  With a shift of zero,
+ *  the default, the result is just p.  Otherwise it is (p + (1 << (shift-1))) >> shift,
+ *  less one if that is odd and p is an exact tie, i.e., the low shift bits of p are
+ *  exactly 1 << (shift-1); the correction is a compare and a masked subtract per vector.
+ *  Exact ties are thus no obstacle, and power-of-two downscales, e.g., 0.5 or
+ *  std::ratio<1,4>, are exact with a multiplier of one.
+ *
+ *  ToFixedPoint chooses the smallest shift, and the corresponding multiplier, for which
+ *  the result equals that of the floating point reference for every value representable
+ *  in the given number of source bits; the choice is verified exhaustively.  It returns
+ *  no value if no multiplier of 32 bits suffices, in which case the floating point path
+ *  is used.  A scale factor may be a floating point value or a std::ratio, e.g.,
+ *  std::ratio<255,1023> for 10-bit to 8-bit conversion.
+ */
+
+        struct FixedPointScale
+          {
+            ///  the multiplier, of at most 32 bits
+            std::int64_t multiplier = 1;
+            ///  the number of fraction bits of the multiplier
+            int shift = 0;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for tables of scaled pixel values.
+ *
+ *  A lookup table holds the scaled, rounded, and clamped value of every 8-bit source
+ *  value, so scaling an 8-bit pixel is a single load; the 256-entry table is held in the
+ *  object itself, with no allocation, and fits in a few cache lines.  Wider sources use
+ *  a fixed-point scale instead, since a SIMD multiplication scales many pixels per
+ *  instruction while table lookups are scalar.
+ */
+
+        template <typename DstPixelT>
+          class ScaleLookupTable
+            {
+//
+//  Constructor ...
+//
+              public:
+                template <typename ScaleT>
+                  explicit ScaleLookupTable(const ScaleT& scaleFactor);
+//
+//  Accessors ...
+//
+              public:
+                const DstPixelT* Table() const;
+//
+//  Data ...
+//
+              private:
+                ///  the scaled value of each source value
+                std::array<DstPixelT,256> table;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The pixel conversion functions ...
+//
+//  ConvertPixels converts count pixels from one pixel type to another: conversion to a
+//  wider type is exact, narrowing integer conversion saturates, and conversion from a
+//  floating point type to an integer type rounds to nearest, ties to even, and clamps.
+//  ScalePixels also multiplies each pixel by the scale factor, rounding and clamping once,
+//  after scaling, in a single pass.  Conversion to and from Half rounds to nearest even.
+//  When both pixel types are integers, the converting DirectImage constructors scale
+//  8-bit sources with a lookup table, and wider sources with a fixed-point scale for the
+//  source bits per sample, whenever one exists.
+//
+//  These rules define the results of the converting DirectImage constructors, which is
+//  a change for code expecting each pixel to be converted with a static_cast.  The
+//  results differ only where a static_cast truncates or overflows: floating point values
+//  with fractions now round to nearest rather than toward zero, and out-of-range values
+//  now saturate rather than wrapping around, or, for floating point sources, being
+//  undefined.  Exactly representable values convert as before.
+//
+//  The common conversions, among std::uint8_t, std::uint16_t, float, and Half, and the
+//  scaling of those types, use SIMD kernels selected by ISL::Image::Dispatch; others use
+//  the scalar reference functions, whose results the SIMD kernels reproduce exactly.  The
+//  converting DirectImage constructors call these functions once per row, or once for
+//  the whole image when its pixels are contiguous.
+//
+
+    namespace ISL::Image
+      {
+        template <typename SrcPixelT,
+                  typename DstPixelT>
+          void ConvertPixels(const SrcPixelT* src,
+                             DstPixelT*       dst,
+                             std::ptrdiff_t   count);
+
+        template <typename SrcPixelT,
+                  typename DstPixelT,
+                  typename ScaleT>
+          void ScalePixels(const SrcPixelT* src,
+                           DstPixelT*       dst,
+                           std::ptrdiff_t   count,
+                           const ScaleT&    scaleFactor);
+
+        template <typename SrcPixelT,
+                  typename DstPixelT>
+          void ScalePixels(const SrcPixelT*                   src,
+                           DstPixelT*                         dst,
+                           std::ptrdiff_t                     count,
+                           const ISL::Image::FixedPointScale& scale);
+
+        template <typename DstPixelT>
+          void ScalePixels(const std::uint8_t*                            src,
+                           DstPixelT*                                     dst,
+                           std::ptrdiff_t                                 count,
+                           const ISL::Image::ScaleLookupTable<DstPixelT>& table);
+
+        template <typename SrcPixelT,
+                  typename DstPixelT>
+          void ConvertPixelsReference(const SrcPixelT* src,
+                                      DstPixelT*       dst,
+                                      std::ptrdiff_t   count);
+
+        template <typename SrcPixelT,
+                  typename DstPixelT,
+                  typename ScaleT>
+          void ScalePixelsReference(const SrcPixelT* src,
+                                    DstPixelT*       dst,
+                                    std::ptrdiff_t   count,
+                                    const ScaleT&    scaleFactor);
+
+        std::optional<ISL::Image::FixedPointScale> ToFixedPoint(double scaleFactor,
+                                                                int    srcBitsPerSample);
+
+        template <std::intmax_t numerator,
+                  std::intmax_t denominator>
+          std::optional<ISL::Image::FixedPointScale>
+            ToFixedPoint(std::ratio<numerator,denominator> scaleFactor,
+                         int                               srcBitsPerSample);
+      }
+
+  #endif
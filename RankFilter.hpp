@@ -0,0 +1,83 @@
+/**
+ *  @file  RankFilter.hpp
+ *
+ *  @brief  Constant-time median and rank filters for 8-bit and 16-bit images.
+ *
+ *  Constant-time median and rank filters for 8-bit and 16-bit images.
+ */
+
+  #ifndef   ISL_IMAGE_RANK_FILTER_HPP_INCLUDED
+    #define ISL_IMAGE_RANK_FILTER_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <concepts>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  a pixel type for which histogram-based rank filters are provided
+        template <typename PixelT>
+          concept RankFilterPixel = std::unsigned_integral<PixelT> && (sizeof(PixelT) <= 2);
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The rank filter functions ...
+//
+//  The filters use the Perreault-Hebert algorithm.  A histogram is kept for each column
+//  of the image, covering the 2r+1 rows of the window; moving down a row adds one pixel
+//  to, and removes one pixel from, each column histogram.  The window histogram is then
+//  moved along the row by adding the column histogram entering the window and
+//  subtracting the one leaving it, so the cost per pixel is constant in the radius r.
+//  The histogram additions and subtractions are SIMD vector operations on the bins.
+//  For 16-bit pixels the histograms have two levels, 256 coarse bins each with 256 fine
+//  bins, and only the fine bins of the coarse bin containing the rank are visited.  Only
+//  the window histogram has fine bins, since 65536 fine bins per column would need
+//  hundreds of megabytes per strip on wide images.  Each column histogram has just the
+//  256 coarse bins, with the 2r+1 pixels of the column grouped by coarse bin, so a
+//  column's pixels in any coarse bin are found directly; the column storage is thus
+//  512+2*(2r+1) bytes, e.g., under 5 MB per strip for an 8K-wide image and r = 10.  The
+//  fine bins of each coarse bin of the window are updated lazily, only when the rank
+//  falls in that coarse bin, from the pixels in that bin of the columns which have
+//  entered and left the window since its last update.  Since the rank's coarse bin
+//  rarely changes from one pixel to the next, the cost per pixel stays nearly constant.
+//
+//  The image is divided into horizontal strips which are filtered in parallel according
+//  to the tile schedule; each strip initializes its column histograms from the rows
+//  above it.  Pixels beyond the image bounds are those of a padded view of the image
+//  with the given padder.  The rank counts from zero, the smallest value in the window,
+//  to (2r+1)^2-1, the largest; the median is the rank 2r(r+1).  A std::out_of_range is
+//  thrown for any other rank.
+//
+
+    namespace ISL::Image
+      {
+        template <typename ImageT,
+                  typename PadderT>
+            requires ISL::Image::RankFilterPixel<typename ImageT::Pixel>
+          ImageT RankFilter(const ImageT&                   image,
+                            ISL::Image::Size                radius,
+                            std::ptrdiff_t                  rank,
+                            const PadderT&                  padder,
+                            const ISL::Image::TileSchedule& schedule);
+
+        template <typename ImageT,
+                  typename PadderT>
+            requires ISL::Image::RankFilterPixel<typename ImageT::Pixel>
+          ImageT MedianFilter(const ImageT&                   image,
+                              ISL::Image::Size                radius,
+                              const PadderT&                  padder,
+                              const ISL::Image::TileSchedule& schedule);
+      }
+
+  #endif
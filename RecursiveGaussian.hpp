@@ -0,0 +1,132 @@
+/**
+ *  @file  RecursiveGaussian.hpp
+ *
+ *  @brief  Recursive (IIR) Gaussian and exponential smoothing filters.
+ *
+ *  Recursive (IIR) Gaussian and exponential smoothing filters.
+ */
+
+  #ifndef   ISL_IMAGE_RECURSIVE_GAUSSIAN_HPP_INCLUDED
+    #define ISL_IMAGE_RECURSIVE_GAUSSIAN_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <array>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  the recursive approximations of the Gaussian
+        enum class RecursiveGaussianMethod
+          {
+            Deriche,       ///<  Deriche: 4th order causal and anti-causal filters, summed
+            YoungVanVliet  ///<  Young and van Vliet: 3rd order forward and backward filters
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class for recursive (IIR) Gaussian smoothing filters.
+ *
+ *  A recursive Gaussian approximates convolution with a Gaussian by a few feedback
+ *  filters run forward and backward along each row and then each column, so the cost per
+ *  pixel is a small constant, independent of sigma; for sigmas above about 5 it is
+ *  cheaper than any FIR Gaussian.  The approximation is accurate to about 1% for sigmas
+ *  of 1 or more; for smaller sigmas use a separable FIR Gaussian.  The edges are handled
+ *  as if the edge pixels were replicated indefinitely, by initializing each filter to its
+ *  steady state for the edge pixel, with initial conditions which depend on the method.
+ *  The Deriche causal and anti-causal filters run independently on the input and are
+ *  summed, so each is initialized to its response to a constant input: the edge pixel
+ *  times the filter's DC gain, the sum of its feedforward coefficients divided by one
+ *  plus the sum of the feedback coefficients.  The Young-van Vliet backward filter runs
+ *  on the output of the forward filter, whose end state carries the whole row, so its
+ *  initial conditions are computed from the last three forward outputs with the
+ *  Triggs-Sdika matrix.
+ *
+ *  The rows are filtered in parallel, each forward and then backward in a single thread.
+ *  The columns are filtered in blocks of adjacent columns, one column per SIMD lane,
+ *  walking down and then up the rows, so each step reads and writes whole cache lines;
+ *  the blocks are filtered in parallel.  Intermediate values are float.
+ */
+
+        class RecursiveGaussian
+          {
+//
+//  Constructor ...
+//
+            public:
+              RecursiveGaussian(double                              sigma_,
+                                ISL::Image::RecursiveGaussianMethod method_);
+//
+//  Accessors ...
+//
+            public:
+              double Sigma() const;
+              ISL::Image::RecursiveGaussianMethod Method() const;
+//
+//  Filtering ...
+//
+            public:
+              template <typename ImageT>
+                ImageT Smooth(const ImageT&                   image,
+                              const ISL::Image::TileSchedule& schedule) const;
+//
+//  Data ...
+//
+            private:
+              ///  the standard deviation of the Gaussian
+              const double sigma;
+              ///  the recursive approximation
+              const ISL::Image::RecursiveGaussianMethod method;
+              ///  the feedforward coefficients of the causal (forward) filter
+              std::array<float,4> causal = {};
+              ///  the feedforward coefficients of the anti-causal (backward) filter
+              std::array<float,4> antiCausal = {};
+              ///  the feedback coefficients, shared by both directions
+              std::array<float,4> feedback = {};
+              ///  the DC gains of the causal and anti-causal filters, for Deriche edges
+              std::array<float,2> edgeGain = {};
+              ///  the Triggs-Sdika matrix for the Young-van Vliet backward initial
+              ///  conditions, row-major
+              std::array<float,9> boundary = {};
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The recursive smoothing functions ...
+//
+//  GaussianSmooth is shorthand for smoothing with a RecursiveGaussian.  ExponentialSmooth
+//  applies the first order filter y[n] = alpha*x[n] + (1-alpha)*y[n-1] forward and then
+//  backward along the rows and the columns, with the same parallel structure; alpha is in
+//  (0,1], and smaller values smooth more.
+//
+
+    namespace ISL::Image
+      {
+        template <typename ImageT>
+          ImageT GaussianSmooth(const ImageT&                       image,
+                                double                              sigma,
+                                ISL::Image::RecursiveGaussianMethod method,
+                                const ISL::Image::TileSchedule&     schedule);
+
+        template <typename ImageT>
+          ImageT ExponentialSmooth(const ImageT&                   image,
+                                   double                          alpha,
+                                   const ISL::Image::TileSchedule& schedule);
+      }
+
+  #endif
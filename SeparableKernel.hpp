@@ -0,0 +1,141 @@
+/**
+ *  @file  SeparableKernel.hpp
+ *
+ *  @brief  A class template for separable convolution kernels.
+ *
+ *  A class template for separable convolution kernels.
+ */
+
+  #ifndef   ISL_IMAGE_SEPARABLE_KERNEL_HPP_INCLUDED
+    #define ISL_IMAGE_SEPARABLE_KERNEL_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TiledConvolution.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <concepts>
+    #include <vector>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+
+/**
+ *  @brief  A class template for separable convolution kernels.
+ *
+ *  A separable kernel is the outer product of a horizontal and a vertical one-dimensional
+ *  kernel; most smoothing and gradient kernels (Gaussian, box, binomial, Sobel) are
+ *  separable.  Convolve applies it as a horizontal pass followed by a vertical pass, so
+ *  a WxH kernel costs W+H, rather than W*H, multiply-adds per pixel.
+ *
+ *  The passes are interleaved through a strip buffer of rows, sized to remain in the
+ *  per-core cache: each source row is filtered horizontally into the strip, and each
+ *  output row is then the vertical combination of H strip rows, so the intermediate
+ *  image is never written to memory.  The horizontal pass is vectorized across output
+ *  pixels, one output pixel per SIMD lane, with the kernels selected by
+ *  ISL::Image::Dispatch; the vertical pass is a vectorized sum of scaled rows.
+ *
+ *  The source image must cover the destination bounds extended by the kernel bounds,
+ *  e.g., an image produced by a padder, a padded view, or an image re-padded in its
+ *  margin.  Products and sums are computed in the common type of the weight and pixel
+ *  types, std::common_type_t<WeightT,PixelT>, so integer weights on floating point
+ *  pixels, e.g., SobelXKernel<int> on a float image, lose nothing; integer destination
+ *  pixels are rounded and clamped to the range of the pixel type.
+ *
+ *  Convolve runs ConvolveTile on the tiles of the schedule, or of a default schedule,
+ *  with ISL::Image::ConvolveTiled.  ConvolveTile convolves one tile in the calling
+ *  thread, writing the destination pixels in place, into the existing buffer of the
+ *  destination image, whether or not that buffer is shared; it never allocates one.
+ */
+
+        template <typename WeightT>
+          class SeparableKernel
+            {
+//
+//  Types ...
+//
+              public:
+                ///  the weight type
+                using Weight = WeightT;
+//
+//  Constructor ...
+//
+              public:
+                SeparableKernel(const std::vector<WeightT>&    horizontal_,
+                                const std::vector<WeightT>&    vertical_,
+                                const ISL::Image::Coordinates& origin_);
+//
+//  Accessors ...
+//
+              public:
+                const std::vector<WeightT>& Horizontal() const;
+                const std::vector<WeightT>&   Vertical() const;
+                const ISL::Image::Coordinates&  Origin() const;
+                ISL::Image::Bounds Bounds() const;
+//
+//  Convolution ...
+//
+              public:
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void Convolve(const SrcImageT& srcImage,
+                                DstImageT&       dstImage) const;
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void Convolve(const SrcImageT&                srcImage,
+                                DstImageT&                      dstImage,
+                                const ISL::Image::TileSchedule& schedule) const;
+                template <typename SrcImageT,
+                          typename DstImageT>
+                  void ConvolveTile(const SrcImageT& srcImage,
+                                    DstImageT&       dstImage) const;
+//
+//  Data ...
+//
+              private:
+                ///  the horizontal weights, from left to right
+                const std::vector<WeightT> horizontal;
+                ///  the vertical weights, from top to bottom
+                const std::vector<WeightT> vertical;
+                ///  the position of the origin of the kernel within the weights
+                const ISL::Image::Coordinates origin;
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The separable kernel factory functions ...
+//
+//  The Gaussian kernel extends three standard deviations from its origin, and the
+//  Gaussian, box, and binomial kernels are normalized to a sum of one, so their weights
+//  must be of a floating point type.  The binomial kernel of order n has n+1 weights in
+//  each direction.  The Sobel kernels are the unnormalized derivatives in the x and y
+//  directions, with weights of any type.  All the kernels are centered.
+//
+
+    namespace ISL::Image
+      {
+        template <std::floating_point WeightT>
+          ISL::Image::SeparableKernel<WeightT> GaussianKernel(double sigma);
+
+        template <std::floating_point WeightT>
+          ISL::Image::SeparableKernel<WeightT> BoxKernel(ISL::Image::Size width,
+                                                         ISL::Image::Size height);
+
+        template <std::floating_point WeightT>
+          ISL::Image::SeparableKernel<WeightT> BinomialKernel(int order);
+
+        template <typename WeightT>
+          ISL::Image::SeparableKernel<WeightT> SobelXKernel();
+
+        template <typename WeightT>
+          ISL::Image::SeparableKernel<WeightT> SobelYKernel();
+      }
+
+  #endif
@@ -0,0 +1,95 @@
+/**
+ *  @file  TileSchedule.hpp
+ *
+ *  @brief  The partitioning of images into tiles for parallel processing.
+ *
+ *  The partitioning of images into tiles for parallel processing.
+ */
+
+  #ifndef   ISL_IMAGE_TILE_SCHEDULE_HPP_INCLUDED
+    #define ISL_IMAGE_TILE_SCHEDULE_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+
+    #include <vector>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  the assignment of tiles to threads
+        enum class TileAssignment
+          {
+            Dynamic,  ///<  tiles are taken by whichever thread is idle, with work stealing
+            Static    ///<  each thread processes a fixed, contiguous range of the tiles
+          };
+
+/**
+ *  @brief  The partitioning of an image into tiles for parallel processing.
+ *
+ *  A tile schedule describes how an image operation is split into tiles which are
+ *  processed independently on a thread pool.  A tile width of zero produces row bands
+ *  spanning the full width of the image; a tile height of zero chooses the height so that
+ *  one tile occupies about tileBytes bytes.  Images with fewer pixels than the serial
+ *  threshold are processed by the calling thread, since for them dispatching the work
+ *  costs more than it saves.  Each pixel belongs to exactly one tile, so the results of
+ *  an operation never depend upon its schedule.
+ *
+ *  With dynamic assignment, the default, idle threads steal tiles, which balances uneven
+ *  work.  With static assignment the rows of the bounds are first divided into as many
+ *  bands of nearly equal height as there are threads, and the i-th band belongs to the
+ *  i-th worker thread of the pool, which is bound to its own core.  The bands depend only
+ *  on the bounds and the thread count, not on the tile size, the pixel type, or any
+ *  halo; the tiles are cut from within the bands, never across them, and each tile is
+ *  processed by the thread of its band.  Every stage over the same bounds with the same
+ *  thread count, whatever its pixel type or tile geometry, thus processes each row of
+ *  pixels on the same core, so the data written by one stage stays local to the core,
+ *  and to its NUMA node, which reads it in the next.
+ */
+
+        struct TileSchedule
+          {
+            ///  the maximum number of threads; zero uses the hardware concurrency
+            int threadCount = 0;
+            ///  the tile width, in pixels; zero uses the full width of the image
+            ISL::Image::Size tileWidth = 0;
+            ///  the tile height, in pixels; zero derives the height from tileBytes
+            ISL::Image::Size tileHeight = 0;
+            ///  the approximate size of a tile, in bytes, when deriving the tile height
+            std::ptrdiff_t tileBytes = 256*1024;
+            ///  images with fewer pixels than this are processed serially
+            ISL::Image::Size serialThreshold = 64*1024;
+            ///  the assignment of tiles to threads
+            ISL::Image::TileAssignment assignment = ISL::Image::TileAssignment::Dynamic;
+          };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The tiling functions ...
+//
+
+    namespace ISL::Image
+      {
+        bool IsSerial(const ISL::Image::Bounds&       bounds,
+                      const ISL::Image::TileSchedule& schedule);
+
+        std::vector<ISL::Image::Bounds> Tiles(const ISL::Image::Bounds&       bounds,
+                                              std::ptrdiff_t                  bytesPerPixel,
+                                              const ISL::Image::TileSchedule& schedule);
+
+        template <typename FunctionT>
+          void ForEachTile(const ISL::Image::Bounds&       bounds,
+                           std::ptrdiff_t                  bytesPerPixel,
+                           const ISL::Image::TileSchedule& schedule,
+                           const FunctionT&                function);
+      }
+
+  #endif
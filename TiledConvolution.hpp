@@ -0,0 +1,99 @@
+/**
+ *  @file  TiledConvolution.hpp
+ *
+ *  @brief  Cache-blocked, multi-threaded execution of convolution kernels.
+ *
+ *  Cache-blocked, multi-threaded execution of convolution kernels.
+ */
+
+  #ifndef   ISL_IMAGE_TILED_CONVOLUTION_HPP_INCLUDED
+    #define ISL_IMAGE_TILED_CONVOLUTION_HPP_INCLUDED
+
+    #include <ISL/Image/ImageBase.hpp>
+    #include <ISL/Image/TileSchedule.hpp>
+
+    #include <concepts>
+    #include <vector>
+
+    #include <cstddef>
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+    namespace ISL::Image
+      {
+        ///  @brief  a kernel which convolves a padded source image into a destination image
+        ///  @note   ConvolveTile must write into the existing buffer of the destination,
+        ///          even if that buffer is shared, and must never reallocate it.
+        template <typename KernelT,
+                  typename SrcImageT,
+                  typename DstImageT>
+          concept ConvolutionKernel = requires (const KernelT&   kernel,
+                                                const SrcImageT& srcImage,
+                                                DstImageT&       dstImage)
+            {
+              { kernel.Bounds() } -> std::convertible_to<ISL::Image::Bounds>;
+              kernel.ConvolveTile(srcImage,dstImage);
+            };
+      }
+
+
+//-----------------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------------
+
+//
+//  The tiled convolution functions ...
+//
+//  ConvolveTiled moves the kernel over the destination image tile by tile, rather than in
+//  raster order over the whole image.  The destination bounds are divided into tiles
+//  according to the schedule; for each tile, the kernel's ConvolveTile function
+//  convolves a sub-image of the source covering the tile extended by the kernel bounds,
+//  i.e., the tile and its halo, into a sub-image of the destination covering the tile.
+//  A padded source view, e.g., a DirectImage PaddedImageView, is instead given as its
+//  SubView of the tile and its halo.  Both share the image buffers, so nothing is
+//  copied, and the halos of adjacent tiles overlap only in what is read.  Since the
+//  destination sub-image shares its buffer, the kernel must write into that buffer in
+//  place; a kernel which gave a shared destination a new buffer would lose the tile's
+//  results.  If the destination image itself is not writable, i.e., unique and not
+//  read-only, ConvolveTiled first gives it a new buffer, with the same bounds, as
+//  TransformInto does.
+//
+//  The tile width and height have their TileSchedule meanings: a tile width of zero makes
+//  full-width bands, and a tile height of zero makes each band tall enough that the
+//  source rows of a tile and its halo fill about the schedule's tile bytes, which keeps
+//  the working set of even a large kernel cache resident.  When the tile width is zero
+//  but a full-width band of the tile height plus the halo rows, or of a single row plus
+//  the halo rows if the tile height is zero, exceeds the tile bytes, as on very wide
+//  images, ConvolveTiled chooses the largest tile width whose tile and halo fit, so
+//  callers need not set it.  A derived tile width or height is never less than one
+//  column or row, even when the halo alone exceeds the tile bytes.  The tiles are
+//  distributed across the threads of the schedule.  HaloTiles returns the tiles which
+//  ConvolveTiled uses.
+//
+//  The Convolve functions of the separable, compiled, and fixed kernels run through
+//  ConvolveTiled, with a default schedule unless one is given, so their callers are tiled
+//  and parallel with no change; the results are the same, since each destination pixel is
+//  computed exactly once, from the same source pixels.  The source image must cover the
+//  destination bounds extended by the kernel bounds.
+//
+
+    namespace ISL::Image
+      {
+        template <typename KernelT,
+                  typename SrcImageT,
+                  typename DstImageT>
+            requires ISL::Image::ConvolutionKernel<KernelT,SrcImageT,DstImageT>
+          void ConvolveTiled(const KernelT&                  kernel,
+                             const SrcImageT&                srcImage,
+                             DstImageT&                      dstImage,
+                             const ISL::Image::TileSchedule& schedule);
+
+        std::vector<ISL::Image::Bounds>
+          HaloTiles(const ISL::Image::Bounds&       bounds,
+                    const ISL::Image::Bounds&       kernelBounds,
+                    std::ptrdiff_t                  bytesPerPixel,
+                    const ISL::Image::TileSchedule& schedule);
+      }
+
+  #endif